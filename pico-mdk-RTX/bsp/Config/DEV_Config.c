@@ -27,6 +27,7 @@
 # THE SOFTWARE.
 ******************************************************************************/
 #include "DEV_Config.h"
+#include "hardware/irq.h"
 #include <assert.h>
 
 #define SPI_PORT spi1
@@ -84,6 +85,62 @@ void DEV_SPI_Write_nByte(uint8_t pData[], uint32_t Len)
     spi_write_blocking(SPI_PORT, pData, Len);
 }
 
+/**
+ * SPI DMA, transmit only. Done runs in the DMA interrupt once the last bit
+ * has left the shifter
+**/
+static int SPI_DMA_Channel = -1;
+static DEV_SPI_DMA_DONE SPI_DMA_Done;
+
+static void DEV_SPI_DMA_IRQHandler(void)
+{
+    if((dma_hw->ints0 & (1u << SPI_DMA_Channel)) == 0) {
+        return;
+    }
+    dma_hw->ints0 = 1u << SPI_DMA_Channel;
+
+    //DMA ends when the last byte enters the FIFO, at most 8 bytes are still shifting out
+    while(spi_is_busy(SPI_PORT)) {
+    }
+    //Nothing reads RX during DMA, drop it so the next blocking transfer starts clean
+    while(spi_get_hw(SPI_PORT)->sr & SPI_SSPSR_RNE_BITS) {
+        (void)spi_get_hw(SPI_PORT)->dr;
+    }
+    spi_get_hw(SPI_PORT)->icr = SPI_SSPICR_RORIC_BITS;
+
+    if(SPI_DMA_Done != NULL) {
+        SPI_DMA_Done();
+    }
+}
+
+bool DEV_SPI_DMA_Init(DEV_SPI_DMA_DONE Done)
+{
+    dma_channel_config Config;
+
+    SPI_DMA_Channel = dma_claim_unused_channel(false);
+    if(SPI_DMA_Channel < 0) {
+        return false;
+    }
+    SPI_DMA_Done = Done;
+
+    Config = dma_channel_get_default_config(SPI_DMA_Channel);
+    channel_config_set_transfer_data_size(&Config, DMA_SIZE_8);
+    channel_config_set_read_increment(&Config, true);
+    channel_config_set_write_increment(&Config, false);
+    channel_config_set_dreq(&Config, spi_get_dreq(SPI_PORT, true));
+    dma_channel_configure(SPI_DMA_Channel, &Config, &spi_get_hw(SPI_PORT)->dr, NULL, 0, false);
+
+    dma_channel_set_irq0_enabled(SPI_DMA_Channel, true);
+    irq_add_shared_handler(DMA_IRQ_0, DEV_SPI_DMA_IRQHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+    return true;
+}
+
+void DEV_SPI_Write_DMA(const uint8_t *pData, uint32_t Len)
+{
+    dma_channel_transfer_from_buffer_now(SPI_DMA_Channel, pData, Len);
+}
+
 
 
 /**
@@ -34,6 +34,7 @@
 #include "stdio.h"
 #include "hardware/i2c.h"
 #include "hardware/pwm.h"
+#include "hardware/dma.h"
 
 /**
  * data
@@ -94,6 +95,10 @@ UBYTE DEV_Digital_Read(UWORD Pin);
 void DEV_SPI_WriteByte(UBYTE Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
 
+typedef void (*DEV_SPI_DMA_DONE)(void);
+bool DEV_SPI_DMA_Init(DEV_SPI_DMA_DONE Done);
+void DEV_SPI_Write_DMA(const uint8_t *pData, uint32_t Len);
+
 void DEV_Delay_ms(UDOUBLE xms);
 void DEV_Delay_us(UDOUBLE xus);
 
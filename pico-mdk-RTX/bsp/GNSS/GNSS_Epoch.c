@@ -0,0 +1,281 @@
+/*****************************************************************************
+* | File      	:   GNSS_Epoch.c
+* | Author      :   Noah Maceri
+* | Function    :   Groups the NMEA sentences of one fix interval into a record
+* | Info        :
+*                The L76B reports one epoch as several sentences (RMC, GGA,
+*                GSA, ZDA) that all carry the same UTC stamp. The assembler
+*                collects them by that stamp and hands out a single record
+*                per epoch, so date, time and position always belong together
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "GNSS_Epoch.h"
+#include <string.h>
+
+/******************************************************************************
+function :	Start assembling a new epoch, the previous one is published first
+            if it never completed. Values are carried forward, flags are not
+parameter:
+    Epoch   : Assembler
+    Stamped : Time holds the UTC stamp of the new epoch
+    Time    : HHMMSSss
+******************************************************************************/
+static void GNSS_Epoch_Start(GNSS_EPOCH *Epoch, bool Stamped, UDOUBLE Time)
+{
+    satellite_data *data = &Epoch->Current;
+
+    GNSS_Epoch_Flush(Epoch);
+    Epoch->Seen = 0;
+    Epoch->Published = false;
+    Epoch->Stamped = Stamped;
+    data->fresh = 0;
+
+    if(Stamped) {
+        data->time = Time;
+        data->hour = Time / 1000000;        //First two digits
+        data->minute = Time / 10000 % 100;  //Next two digits
+        data->second = Time / 100 % 100;    //Last two whole digits
+        data->fresh |= GNSS_FRESH_TIME;
+    }
+}
+
+/******************************************************************************
+function :	Find the epoch a sentence belongs to, starting a new one when its
+            UTC stamp moves on
+parameter:
+    Epoch     : Assembler
+    Type      : Sentence being decoded
+    Fields    : Its fields
+    TimeIndex : Field holding hhmmss.ss, 0 for sentences without a stamp (GSA)
+return   :  Record to decode into, NULL to drop a sentence without a stamp
+            that arrives after its epoch was handed out
+******************************************************************************/
+static satellite_data *GNSS_Epoch_Open(GNSS_EPOCH *Epoch, NMEA_SENTENCE Type, const NMEA_FIELDS *Fields, UBYTE TimeIndex)
+{
+    NMEA_FIELD f;
+    int32_t time;
+
+    if(TimeIndex == 0) {
+        //No stamp, belongs to whatever epoch is open. Once that epoch is published
+        //(a second GNGSA after the last stamped sentence) it can only be dropped
+        return Epoch->Published ? NULL : &Epoch->Current;
+    }
+
+    f = NMEA_GetField(Fields, TimeIndex);
+    if(NMEA_ParseFixed(f.Ptr, f.Length, 2, &time)) {
+        if(!Epoch->Stamped || (UDOUBLE)time != Epoch->Current.time) {
+            GNSS_Epoch_Start(Epoch, true, time);
+        }
+    } else if(Epoch->Stamped || (Epoch->Seen & GNSS_EPOCH_BIT(Type)) != 0) {
+        //No time yet (cold start), a repeated sentence type is the only sign of a new epoch
+        if(Epoch->Seen != 0 || Epoch->Stamped) {
+            GNSS_Epoch_Start(Epoch, false, 0);
+        }
+    }
+    return &Epoch->Current;
+}
+
+/******************************************************************************
+function :	Mark a sentence as received and publish once the epoch is complete
+parameter:
+    Epoch : Assembler
+    Type  : Sentence just decoded
+******************************************************************************/
+static void GNSS_Epoch_Close(GNSS_EPOCH *Epoch, NMEA_SENTENCE Type)
+{
+    Epoch->Seen |= GNSS_EPOCH_BIT(Type);
+    if((Epoch->Seen & Epoch->Expected) == Epoch->Expected) {
+        GNSS_Epoch_Flush(Epoch);
+    }
+}
+
+/******************************************************************************
+function :	Initialize the assembler
+parameter:
+    Epoch    : Assembler
+    Expected : GNSS_EPOCH_BIT of each sentence enabled with PMTK314, an epoch is
+               published as soon as all of them have arrived
+    Publish  : Called once per epoch with the assembled record
+******************************************************************************/
+void GNSS_Epoch_Init(GNSS_EPOCH *Epoch, UWORD Expected, GNSS_EPOCH_PUBLISH Publish)
+{
+    memset(Epoch, 0, sizeof(GNSS_EPOCH));
+    Epoch->Current.lock_type = '0';
+    Epoch->Expected = Expected;
+    Epoch->Publish = Publish;
+}
+
+/******************************************************************************
+function :	Publish the open epoch now, even if sentences are missing.
+            Called automatically when the next epoch begins
+parameter:
+    Epoch : Assembler
+******************************************************************************/
+void GNSS_Epoch_Flush(GNSS_EPOCH *Epoch)
+{
+    if(Epoch->Published || Epoch->Seen == 0) {
+        return;
+    }
+    Epoch->Published = true;
+    if(Epoch->Publish != NULL) {
+        Epoch->Publish(&Epoch->Current);
+    }
+}
+
+/******************************************************************************
+function :	RMC, $--RMC,hhmmss.ss,A,ddmm.mmmm,N,dddmm.mmmm,W,knots,course,ddmmyy,... (Recommended Minimum data)
+parameter:
+******************************************************************************/
+void GNSS_Epoch_DecodeRMC(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context)
+{
+    GNSS_EPOCH *epoch = (GNSS_EPOCH *)Context;
+    satellite_data *data = GNSS_Epoch_Open(epoch, NMEA_SENTENCE_RMC, Fields, 1);
+    NMEA_FIELD f;
+    int32_t lat, lon, date;
+    char latArea, lonArea, status;
+
+    status = NMEA_GetChar(Fields, 2);
+    if(status != '\0') {
+        data->status = status; //An empty field keeps the last A/V
+        data->fresh |= GNSS_FRESH_STATUS;
+    }
+
+    latArea = NMEA_GetChar(Fields, 4);
+    lonArea = NMEA_GetChar(Fields, 6);
+    f = NMEA_GetField(Fields, 3);
+    if(NMEA_ParseCoordinate(f.Ptr, f.Length, latArea, &lat)) {
+        f = NMEA_GetField(Fields, 5);
+        if(NMEA_ParseCoordinate(f.Ptr, f.Length, lonArea, &lon)) {
+            data->lat = lat;
+            data->lon = lon;
+            data->lat_area = latArea;
+            data->lon_area = lonArea;
+            data->fresh |= GNSS_FRESH_POSITION;
+        }
+    }
+
+    f = NMEA_GetField(Fields, 9);
+    if(f.Length == 6 && NMEA_ParseFixed(f.Ptr, f.Length, 0, &date)) {
+        data->day = date / 10000;
+        data->month = date / 100 % 100;
+        data->year = 2000 + date % 100;
+        data->fresh |= GNSS_FRESH_DATE;
+    }
+
+    GNSS_Epoch_Close(epoch, NMEA_SENTENCE_RMC);
+}
+
+/******************************************************************************
+function :	GGA, $--GGA,hhmmss.ss,ddmm.mmmm,N,dddmm.mmmm,W,fix,sats,hdop,alt,M,sep,M,age,station*hh (Global Positioning System Fix Data)
+parameter:
+******************************************************************************/
+void GNSS_Epoch_DecodeGGA(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context)
+{
+    GNSS_EPOCH *epoch = (GNSS_EPOCH *)Context;
+    satellite_data *data = GNSS_Epoch_Open(epoch, NMEA_SENTENCE_GGA, Fields, 1);
+    NMEA_FIELD f;
+    int32_t lat, lon, value;
+    char latArea, lonArea;
+
+    latArea = NMEA_GetChar(Fields, 3);
+    lonArea = NMEA_GetChar(Fields, 5);
+    f = NMEA_GetField(Fields, 2);
+    if(NMEA_ParseCoordinate(f.Ptr, f.Length, latArea, &lat)) {
+        f = NMEA_GetField(Fields, 4);
+        if(NMEA_ParseCoordinate(f.Ptr, f.Length, lonArea, &lon)) {
+            data->lat = lat;
+            data->lon = lon;
+            data->lat_area = latArea;
+            data->lon_area = lonArea;
+            data->fresh |= GNSS_FRESH_POSITION;
+        }
+    }
+
+    data->lock_type = NMEA_GetChar(Fields, 6);
+    if(data->lock_type == '\0') {
+        data->lock_type = '0'; //Empty fix field means no fix
+    }
+    f = NMEA_GetField(Fields, 7);
+    if(NMEA_ParseFixed(f.Ptr, f.Length, 0, &value)) {
+        data->num_of_sats = value;
+        data->fresh |= GNSS_FRESH_SATS;
+    }
+
+    f = NMEA_GetField(Fields, 9);
+    if(NMEA_ParseFixed(f.Ptr, f.Length, 2, &data->altitude)) {
+        data->fresh |= GNSS_FRESH_ALTITUDE;
+    }
+
+    GNSS_Epoch_Close(epoch, NMEA_SENTENCE_GGA);
+}
+
+/******************************************************************************
+function :	GSA, $--GSA,A,3,sv,...,sv,pdop,hdop,vdop*hh (DOP and active satellites)
+            Multi-constellation receivers send one per system, the DOPs are
+            those of the combined solution so the last one wins
+parameter:
+******************************************************************************/
+void GNSS_Epoch_DecodeGSA(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context)
+{
+    GNSS_EPOCH *epoch = (GNSS_EPOCH *)Context;
+    satellite_data *data = GNSS_Epoch_Open(epoch, NMEA_SENTENCE_GSA, Fields, 0);
+    NMEA_FIELD f;
+    int32_t pdop, hdop, vdop, mode;
+
+    if(data == NULL) {
+        return;
+    }
+
+    f = NMEA_GetField(Fields, 2);
+    if(NMEA_ParseFixed(f.Ptr, f.Length, 0, &mode)) {
+        data->fix_mode = mode;
+    }
+
+    f = NMEA_GetField(Fields, 15);
+    if(NMEA_ParseFixed(f.Ptr, f.Length, 2, &pdop)) {
+        f = NMEA_GetField(Fields, 16);
+        if(NMEA_ParseFixed(f.Ptr, f.Length, 2, &hdop)) {
+            f = NMEA_GetField(Fields, 17);
+            if(NMEA_ParseFixed(f.Ptr, f.Length, 2, &vdop)) {
+                data->pdop = pdop;
+                data->hdop = hdop;
+                data->vdop = vdop;
+                data->fresh |= GNSS_FRESH_DOP;
+            }
+        }
+    }
+
+    GNSS_Epoch_Close(epoch, NMEA_SENTENCE_GSA);
+}
+
+/******************************************************************************
+function :	ZDA, $--ZDA,hhmmss.ss,dd,mm,yyyy,zh,zm*hh (Time and date)
+parameter:
+******************************************************************************/
+void GNSS_Epoch_DecodeZDA(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context)
+{
+    GNSS_EPOCH *epoch = (GNSS_EPOCH *)Context;
+    satellite_data *data = GNSS_Epoch_Open(epoch, NMEA_SENTENCE_ZDA, Fields, 1);
+    NMEA_FIELD f;
+    int32_t day, month, year;
+
+    f = NMEA_GetField(Fields, 2);
+    if(NMEA_ParseFixed(f.Ptr, f.Length, 0, &day)) {
+        f = NMEA_GetField(Fields, 3);
+        if(NMEA_ParseFixed(f.Ptr, f.Length, 0, &month)) {
+            f = NMEA_GetField(Fields, 4);
+            if(NMEA_ParseFixed(f.Ptr, f.Length, 0, &year)) {
+                data->day = day;
+                data->month = month;
+                data->year = year;
+                data->fresh |= GNSS_FRESH_DATE;
+            }
+        }
+    }
+
+    GNSS_Epoch_Close(epoch, NMEA_SENTENCE_ZDA);
+}
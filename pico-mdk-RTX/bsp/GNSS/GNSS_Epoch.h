@@ -0,0 +1,85 @@
+/*****************************************************************************
+* | File      	:   GNSS_Epoch.h
+* | Author      :   Noah Maceri
+* | Function    :   Groups the NMEA sentences of one fix interval into a record
+* | Info        :
+*                The L76B reports one epoch as several sentences (RMC, GGA,
+*                GSA, ZDA) that all carry the same UTC stamp. The assembler
+*                collects them by that stamp and hands out a single record
+*                per epoch, so date, time and position always belong together
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __GNSS_EPOCH_H
+#define __GNSS_EPOCH_H
+
+#include "DEV_Config.h"
+#include "NMEA.h"
+
+/**
+ * Fresh flags, set for every field that was decoded in this epoch.
+ * A field without its flag still holds the value from an earlier epoch
+**/
+#define GNSS_FRESH_TIME         0x0001  // GGA, RMC or ZDA
+#define GNSS_FRESH_DATE         0x0002  // ZDA or RMC
+#define GNSS_FRESH_POSITION     0x0004  // GGA or RMC, only when the module has a position
+#define GNSS_FRESH_ALTITUDE     0x0008  // GGA
+#define GNSS_FRESH_SATS         0x0010  // GGA, satellites used and fix quality
+#define GNSS_FRESH_STATUS       0x0020  // RMC
+#define GNSS_FRESH_DOP          0x0040  // GSA
+
+/**
+ * Sentence mask bit for a sentence type
+**/
+#define GNSS_EPOCH_BIT(Type)    (1U << (Type))
+
+/**
+ * One epoch
+**/
+typedef struct{
+    UBYTE day;
+    UBYTE month;
+    UWORD year;
+    UDOUBLE time;       //UTC packed as HHMMSSss
+    UBYTE hour;
+    UBYTE minute;
+    UBYTE second;
+    int32_t lat;        //Microdegrees, negative south
+    int32_t lon;        //Microdegrees, negative west
+    char lat_area;
+    char lon_area;
+    UBYTE lock_type;    //GGA fix quality, '0' = none
+    UBYTE num_of_sats;
+    int32_t altitude;   //Centimetres above mean sea level
+    char status;        //RMC 'A' = valid, 'V' = warning
+    UBYTE fix_mode;     //GSA 1 = none, 2 = 2D, 3 = 3D
+    UWORD pdop;         //Dilution of precision in hundredths
+    UWORD hdop;
+    UWORD vdop;
+    UWORD fresh;        //GNSS_FRESH_* of the fields decoded in this epoch
+}satellite_data;
+
+typedef void (*GNSS_EPOCH_PUBLISH)(const satellite_data *Fix);
+
+typedef struct {
+    satellite_data Current;     // epoch being assembled, older values carried forward
+    UWORD Expected;             // GNSS_EPOCH_BIT of every sentence the module is set to send
+    UWORD Seen;                 // GNSS_EPOCH_BIT of every sentence received for Current
+    bool Stamped;               // Current.time has been set by a sentence
+    bool Published;             // Current has already been handed out
+    GNSS_EPOCH_PUBLISH Publish;
+} GNSS_EPOCH;
+
+void GNSS_Epoch_Init(GNSS_EPOCH *Epoch, UWORD Expected, GNSS_EPOCH_PUBLISH Publish);
+void GNSS_Epoch_Flush(GNSS_EPOCH *Epoch);
+
+//Decoders for NMEA_Dispatch, Context is the GNSS_EPOCH
+void GNSS_Epoch_DecodeRMC(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context);
+void GNSS_Epoch_DecodeGGA(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context);
+void GNSS_Epoch_DecodeGSA(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context);
+void GNSS_Epoch_DecodeZDA(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context);
+
+#endif
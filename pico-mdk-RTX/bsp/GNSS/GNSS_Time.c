@@ -0,0 +1,302 @@
+/*****************************************************************************
+* | File      	:   GNSS_Time.c
+* | Author      :   Noah Maceri
+* | Function    :   PPS disciplined UTC clock
+* | Info        :
+*                The rising edge of the L76B 1PPS output marks the start of
+*                a UTC second. Edges are timestamped against the 64-bit us
+*                timer in the GPIO interrupt, each published epoch names the
+*                second that edge belongs to, and UTC "now" is the named
+*                second plus the timer ticks elapsed since the edge.
+*                While locked the crystal's frequency offset is learned
+*                from PPS, when lock is lost the clock keeps counting with
+*                that correction and reports a growing error bound
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "GNSS_Time.h"
+#include "hardware/timer.h"
+#include "hardware/sync.h"
+
+#define GNSS_SECONDS_PER_DAY    86400
+#define GNSS_DAYS_TO_2000       730425  // 0000-03-01 to 2000-01-01, proleptic Gregorian
+
+//Last PPS edge, written only by the GPIO interrupt
+static volatile uint64_t GNSS_PpsEdge;
+static volatile UDOUBLE GNSS_PpsCount;
+
+//Anchor, UTC second Seconds (since 2000-01-01) began at timer value Local
+//Written only by the GNSS ingest thread, Sequence is odd while it is being updated
+typedef struct {
+    UDOUBLE Seconds;
+    uint64_t Local;
+    GNSS_TIME_SOURCE Source;    // GNSS_TIME_PPS or GNSS_TIME_NMEA, holdover is decided on read
+    int32_t FreqPpb;            // timer rate error, positive when the crystal runs fast
+    UDOUBLE UncertaintyPpb;     // bound on the error of FreqPpb
+} GNSS_ANCHOR;
+
+static GNSS_ANCHOR GNSS_Anchor;
+static volatile UDOUBLE GNSS_AnchorSequence;
+
+//Frequency training, only touched by the GNSS ingest thread
+static UDOUBLE GNSS_RefSeconds;     // PPS anchor the next measurement is taken against
+static uint64_t GNSS_RefLocal;
+static bool GNSS_RefValid;
+static int32_t GNSS_FreqPpb;        // smoothed offset, parts per billion
+static UDOUBLE GNSS_DeviationPpb;   // smoothed |measurement - estimate|
+static bool GNSS_FreqValid;
+
+/******************************************************************************
+function :	Days since 2000-01-01 of a calendar date
+parameter:
+******************************************************************************/
+static UDOUBLE GNSS_Time_DaysFromCivil(UWORD Year, UBYTE Month, UBYTE Day)
+{
+    UDOUBLE y = Year - (Month <= 2);
+    UDOUBLE era = y / 400;
+    UDOUBLE yoe = y - era * 400;
+    UDOUBLE doy = (153 * (Month > 2 ? Month - 3 : Month + 9) + 2) / 5 + Day - 1;
+    UDOUBLE doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - GNSS_DAYS_TO_2000;
+}
+
+/******************************************************************************
+function :	Calendar date of a day count since 2000-01-01
+parameter:
+******************************************************************************/
+static void GNSS_Time_CivilFromDays(UDOUBLE Days, GNSS_UTC *Utc)
+{
+    UDOUBLE z = Days + GNSS_DAYS_TO_2000;
+    UDOUBLE era = z / 146097;
+    UDOUBLE doe = z - era * 146097;
+    UDOUBLE yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    UDOUBLE doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    UDOUBLE mp = (5 * doy + 2) / 153;
+    Utc->Day = doy - (153 * mp + 2) / 5 + 1;
+    Utc->Month = mp < 10 ? mp + 3 : mp - 9;
+    Utc->Year = yoe + era * 400 + (Utc->Month <= 2);
+}
+
+/******************************************************************************
+function :	Latest PPS edge, retried if the interrupt lands mid-read
+parameter:
+    Edge : Timer value of the edge
+return   :  Number of edges seen so far, 0 if none
+******************************************************************************/
+static UDOUBLE GNSS_Time_GetEdge(uint64_t *Edge)
+{
+    UDOUBLE count;
+    do {
+        count = GNSS_PpsCount;
+        *Edge = GNSS_PpsEdge;
+    } while(count != GNSS_PpsCount);
+    return count;
+}
+
+/******************************************************************************
+function :	Replace the anchor, readers retry if they overlap the update
+parameter:
+******************************************************************************/
+static void GNSS_Time_SetAnchor(UDOUBLE Seconds, uint64_t Local, GNSS_TIME_SOURCE Source)
+{
+    GNSS_AnchorSequence++;
+    __dmb();
+    GNSS_Anchor.Seconds = Seconds;
+    GNSS_Anchor.Local = Local;
+    GNSS_Anchor.Source = Source;
+    GNSS_Anchor.FreqPpb = GNSS_FreqValid ? GNSS_FreqPpb : 0;
+    GNSS_Anchor.UncertaintyPpb = GNSS_FreqValid ? GNSS_DeviationPpb + GNSS_FREQ_WANDER_PPB : GNSS_FREQ_UNTRAINED_PPB;
+    __dmb();
+    GNSS_AnchorSequence++;
+}
+
+/******************************************************************************
+function :	Timer ticks since the anchor corrected to true microseconds
+parameter:
+******************************************************************************/
+static uint64_t GNSS_Time_Corrected(const GNSS_ANCHOR *Anchor, uint64_t Elapsed)
+{
+    return Elapsed - (int64_t)Elapsed * Anchor->FreqPpb / 1000000000;
+}
+
+/******************************************************************************
+function :	Error bound of an anchor after Elapsed microseconds
+parameter:
+******************************************************************************/
+static UDOUBLE GNSS_Time_ErrorBound(const GNSS_ANCHOR *Anchor, uint64_t Elapsed)
+{
+    uint64_t bound = (Anchor->Source == GNSS_TIME_PPS) ? GNSS_PPS_ERROR_US : GNSS_NMEA_ERROR_US;
+    bound += Elapsed * Anchor->UncertaintyPpb / 1000000000;
+    return (bound > 0xFFFFFFFFU) ? 0xFFFFFFFFU : (UDOUBLE)bound;
+}
+
+/******************************************************************************
+function :	Measure the timer rate against a PPS anchor GNSS_FREQ_BASELINE_S or
+            more seconds older, the edge count is exact so any gap is usable
+parameter:
+    Seconds : UTC second of the new edge
+    Edge    : Timer value of the new edge
+******************************************************************************/
+static void GNSS_Time_Train(UDOUBLE Seconds, uint64_t Edge)
+{
+    UDOUBLE span;
+    int64_t measured;
+    int32_t error;
+
+    if(!GNSS_RefValid || Seconds <= GNSS_RefSeconds) {
+        GNSS_RefSeconds = Seconds;
+        GNSS_RefLocal = Edge;
+        GNSS_RefValid = true;
+        return;
+    }
+    span = Seconds - GNSS_RefSeconds;
+    if(span < GNSS_FREQ_BASELINE_S) {
+        return;
+    }
+
+    //(ticks - true us) per true us, in ppb
+    measured = ((int64_t)(Edge - GNSS_RefLocal) - (int64_t)span * 1000000) * 1000 / span;
+    GNSS_RefSeconds = Seconds;
+    GNSS_RefLocal = Edge;
+    if(measured > GNSS_FREQ_MAX_PPB || measured < -GNSS_FREQ_MAX_PPB) {
+        return; //Missed or doubled edge, restart the baseline from here
+    }
+
+    if(!GNSS_FreqValid) {
+        GNSS_FreqPpb = measured;
+        GNSS_DeviationPpb = 1000 / GNSS_FREQ_BASELINE_S; //One 1us jitter over the baseline (1000ppb over 1s), until measured
+        GNSS_FreqValid = true;
+        return;
+    }
+    error = measured - GNSS_FreqPpb;
+    GNSS_FreqPpb += error / (1 << GNSS_FREQ_FILTER_SHIFT);
+    GNSS_DeviationPpb += ((int32_t)(error < 0 ? -error : error) - (int32_t)GNSS_DeviationPpb) / (1 << GNSS_FREQ_FILTER_SHIFT);
+}
+
+/******************************************************************************
+function :	Reset the clock, nothing is known until the first epoch is bound
+parameter:
+******************************************************************************/
+void GNSS_Time_Init(void)
+{
+    GNSS_PpsEdge = 0;
+    GNSS_PpsCount = 0;
+    GNSS_AnchorSequence = 0;
+    GNSS_Anchor.Source = GNSS_TIME_NONE;
+    GNSS_RefValid = false;
+    GNSS_FreqPpb = 0;
+    GNSS_DeviationPpb = 0;
+    GNSS_FreqValid = false;
+}
+
+/******************************************************************************
+function :	PPS rising edge, call first thing from the GPIO interrupt so the
+            timestamp only carries the interrupt entry latency
+parameter:
+******************************************************************************/
+void GNSS_Time_PPS(void)
+{
+    uint64_t now = time_us_64();
+    GNSS_PpsEdge = now;
+    GNSS_PpsCount++;
+}
+
+/******************************************************************************
+function :	Bind a published epoch to the PPS edge that started its second.
+            Called from the GNSS ingest thread as each epoch is published,
+            epochs without a lock are ignored and the clock holds over
+parameter:
+    Fix : Epoch, needs a fresh time and date and a position lock
+******************************************************************************/
+void GNSS_Time_Bind(const satellite_data *Fix)
+{
+    uint64_t now, edge, age;
+    UDOUBLE count, seconds, fracUs;
+
+    if(Fix->lock_type == '0' ||
+            (Fix->fresh & (GNSS_FRESH_TIME | GNSS_FRESH_DATE)) != (GNSS_FRESH_TIME | GNSS_FRESH_DATE)) {
+        return; //Without a fix the module's time comes from its own RTC
+    }
+
+    seconds = GNSS_Time_DaysFromCivil(Fix->year, Fix->month, Fix->day) * GNSS_SECONDS_PER_DAY
+              + Fix->hour * 3600 + Fix->minute * 60 + Fix->second;
+    fracUs = (Fix->time % 100) * 10000; //400ms epochs land between edges
+
+    count = GNSS_Time_GetEdge(&edge);
+    now = time_us_64(); //Read after the edge so an edge can never look newer than now
+    if(count != 0) {
+        age = now - edge;
+        if(age < GNSS_PPS_MAX_AGE_US && age + GNSS_PPS_SLACK_US >= fracUs) {
+            if(GNSS_Anchor.Source != GNSS_TIME_PPS || GNSS_Anchor.Local != edge) {
+                GNSS_Time_Train(seconds, edge);
+                GNSS_Time_SetAnchor(seconds, edge, GNSS_TIME_PPS);
+            }
+            return;
+        }
+        if(age < GNSS_PPS_TIMEOUT_US) {
+            return; //PPS is running but this epoch does not fit the last edge, keep the current anchor
+        }
+    }
+
+    //No PPS, hold over on the last edge for as long as that beats NMEA arrival times
+    if(GNSS_Anchor.Source == GNSS_TIME_PPS &&
+            GNSS_Time_ErrorBound(&GNSS_Anchor, now - GNSS_Anchor.Local) < GNSS_NMEA_ERROR_US) {
+        return;
+    }
+    //The epoch instant is roughly when its last sentence arrived
+    GNSS_Time_SetAnchor(seconds, now - fracUs, GNSS_TIME_NMEA);
+}
+
+/******************************************************************************
+function :	Current UTC, safe to call from any thread
+parameter:
+    Utc : Calendar time and microseconds, untouched if the clock is not set
+return   :  What the time is bound to, GNSS_TIME_NONE before the first epoch
+******************************************************************************/
+GNSS_TIME_SOURCE GNSS_Time_Now(GNSS_UTC *Utc)
+{
+    GNSS_ANCHOR anchor;
+    UDOUBLE seq, seconds, sod;
+    uint64_t ticks, elapsed;
+
+    do {
+        seq = GNSS_AnchorSequence;
+        __dmb();
+        anchor = GNSS_Anchor;
+        __dmb();
+    } while((seq & 1U) != 0 || seq != GNSS_AnchorSequence);
+
+    if(anchor.Source == GNSS_TIME_NONE) {
+        return GNSS_TIME_NONE;
+    }
+
+    ticks = time_us_64() - anchor.Local;
+    elapsed = GNSS_Time_Corrected(&anchor, ticks);
+    seconds = anchor.Seconds + (UDOUBLE)(elapsed / 1000000);
+    sod = seconds % GNSS_SECONDS_PER_DAY;
+
+    GNSS_Time_CivilFromDays(seconds / GNSS_SECONDS_PER_DAY, Utc);
+    Utc->Hour = sod / 3600;
+    Utc->Minute = sod / 60 % 60;
+    Utc->Second = sod % 60;
+    Utc->Micros = (UDOUBLE)(elapsed % 1000000);
+    Utc->ErrorUs = GNSS_Time_ErrorBound(&anchor, ticks);
+    Utc->Source = anchor.Source;
+    if(anchor.Source == GNSS_TIME_PPS && ticks >= GNSS_PPS_TIMEOUT_US) {
+        Utc->Source = GNSS_TIME_HOLDOVER;
+    }
+    return Utc->Source;
+}
+
+/******************************************************************************
+function :	Learned frequency offset of the timer crystal
+parameter:
+return   :  Parts per billion, positive when the crystal runs fast, 0 until trained
+******************************************************************************/
+int32_t GNSS_Time_GetFrequency(void)
+{
+    return GNSS_FreqValid ? GNSS_FreqPpb : 0;
+}
@@ -0,0 +1,80 @@
+/*****************************************************************************
+* | File      	:   GNSS_Time.h
+* | Author      :   Noah Maceri
+* | Function    :   PPS disciplined UTC clock
+* | Info        :
+*                The rising edge of the L76B 1PPS output marks the start of
+*                a UTC second. Edges are timestamped against the 64-bit us
+*                timer in the GPIO interrupt, each published epoch names the
+*                second that edge belongs to, and UTC "now" is the named
+*                second plus the timer ticks elapsed since the edge.
+*                While locked the crystal's frequency offset is learned
+*                from PPS, when lock is lost the clock keeps counting with
+*                that correction and reports a growing error bound
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __GNSS_TIME_H
+#define __GNSS_TIME_H
+
+#include "DEV_Config.h"
+#include "GNSS_Epoch.h"
+
+/**
+ * An epoch is bound to the last PPS edge only if it arrived within this long
+ * of it, the L76B starts sending ~100ms behind PPS when PMTK255 is enabled
+**/
+#define GNSS_PPS_MAX_AGE_US     1000000
+#define GNSS_PPS_SLACK_US       20000   // timer vs receiver rounding of fractional epochs
+
+/**
+ * Without PPS edges for this long the clock is in holdover, it is re-bound to
+ * NMEA arrival times only once its error bound exceeds GNSS_NMEA_ERROR_US
+**/
+#define GNSS_PPS_TIMEOUT_US     2000000
+
+/**
+ * Error bound model
+**/
+#define GNSS_PPS_ERROR_US           5       // edge interrupt latency and timer rounding
+#define GNSS_NMEA_ERROR_US          500000  // L76B output and UART transmit delay
+#define GNSS_FREQ_UNTRAINED_PPB     50000   // RP2040 crystal tolerance before any PPS training
+#define GNSS_FREQ_WANDER_PPB        1000    // temperature and ageing drift of the trained estimate
+
+/**
+ * Frequency training, the offset is measured between PPS anchors at least this
+ * far apart (1us timestamp jitter over 16s is ~60ppb) and smoothed by 1/2^SHIFT
+**/
+#define GNSS_FREQ_BASELINE_S        16
+#define GNSS_FREQ_FILTER_SHIFT      2
+#define GNSS_FREQ_MAX_PPB           200000  // larger offsets are a missed or extra edge
+
+typedef enum {
+    GNSS_TIME_NONE = 0,     // no epoch with time and date yet
+    GNSS_TIME_NMEA,         // bound to sentence arrival, off by the transmit delay
+    GNSS_TIME_PPS,          // bound to the PPS edge
+    GNSS_TIME_HOLDOVER,     // PPS lost, counting on the trained crystal
+} GNSS_TIME_SOURCE;
+
+typedef struct {
+    UWORD Year;
+    UBYTE Month;
+    UBYTE Day;
+    UBYTE Hour;
+    UBYTE Minute;
+    UBYTE Second;
+    UDOUBLE Micros;
+    UDOUBLE ErrorUs;        // bound on |displayed - true UTC|
+    GNSS_TIME_SOURCE Source;
+} GNSS_UTC;
+
+void GNSS_Time_Init(void);
+void GNSS_Time_PPS(void);
+void GNSS_Time_Bind(const satellite_data *Fix);
+GNSS_TIME_SOURCE GNSS_Time_Now(GNSS_UTC *Utc);
+int32_t GNSS_Time_GetFrequency(void);
+
+#endif
@@ -0,0 +1,111 @@
+/*****************************************************************************
+* | File      	:   GNSS_UART.c
+* | Author      :   Noah Maceri
+* | Function    :   Interrupt driven UART receive path for the L76B GNSS module
+* | Info        :
+*                The UART RX interrupt empties the 32 byte hardware FIFO into
+*                a ring buffer and raises an event flag at the end of every
+*                line, threads read the ring without ever touching the UART
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "GNSS_UART.h"
+#include "hardware/irq.h"
+
+#define GNSS_RX_MASK    (GNSS_RX_BUFFER_SIZE - 1)
+
+static uart_inst_t *GNSS_Uart;
+static osEventFlagsId_t GNSS_LineFlags;
+static UDOUBLE GNSS_LineFlag;
+
+//Single producer (IRQ) single consumer (reader thread), indices only ever grow
+static char GNSS_RxBuffer[GNSS_RX_BUFFER_SIZE];
+static volatile UWORD GNSS_RxHead;
+static volatile UWORD GNSS_RxTail;
+static volatile UDOUBLE GNSS_RxDropped;
+
+/******************************************************************************
+function :	UART RX / RX timeout interrupt, moves the hardware FIFO into the ring
+parameter:
+******************************************************************************/
+static void GNSS_UART_IRQHandler(void)
+{
+    bool lineEnded = false;
+    UWORD head = GNSS_RxHead;
+
+    while(uart_is_readable(GNSS_Uart)) {
+        char ch = (char)uart_get_hw(GNSS_Uart)->dr;
+        if((UWORD)(head - GNSS_RxTail) >= GNSS_RX_BUFFER_SIZE) {
+            GNSS_RxDropped++; //reader fell behind, drop the newest byte
+            continue;
+        }
+        GNSS_RxBuffer[head & GNSS_RX_MASK] = ch;
+        head++;
+        if(ch == '\n') {
+            lineEnded = true;
+        }
+    }
+    GNSS_RxHead = head;
+
+    if(lineEnded && GNSS_LineFlags != NULL) {
+        osEventFlagsSet(GNSS_LineFlags, GNSS_LineFlag);
+    }
+}
+
+/******************************************************************************
+function :	Initialize the UART and route its receive side through the ring
+parameter:
+    Uart      : uart0 or uart1
+    Baudrate  : Initial baudrate
+    LineFlags : Event flags to raise when a line ending is received (may be NULL)
+    LineFlag  : Flag bit(s) to set
+return   :  Actual baudrate
+******************************************************************************/
+UDOUBLE GNSS_UART_Init(uart_inst_t *Uart, UDOUBLE Baudrate, osEventFlagsId_t LineFlags, UDOUBLE LineFlag)
+{
+    UDOUBLE actual;
+    UBYTE irq = (uart_get_index(Uart) == 0) ? UART0_IRQ : UART1_IRQ;
+
+    GNSS_Uart = Uart;
+    GNSS_LineFlags = LineFlags;
+    GNSS_LineFlag = LineFlag;
+    GNSS_RxHead = 0;
+    GNSS_RxTail = 0;
+    GNSS_RxDropped = 0;
+
+    actual = uart_init(Uart, Baudrate);
+
+    irq_set_exclusive_handler(irq, GNSS_UART_IRQHandler);
+    irq_set_enabled(irq, true);
+    uart_set_irq_enables(Uart, true, false); //RX and RX timeout, TX stays polled
+    return actual;
+}
+
+/******************************************************************************
+function :	Take one received byte out of the ring
+parameter:
+    Ch : Where to store the byte
+return   :  false if the ring is empty
+******************************************************************************/
+bool GNSS_UART_Read(char *Ch)
+{
+    UWORD tail = GNSS_RxTail;
+    if(tail == GNSS_RxHead) {
+        return false;
+    }
+    *Ch = GNSS_RxBuffer[tail & GNSS_RX_MASK];
+    GNSS_RxTail = tail + 1;
+    return true;
+}
+
+/******************************************************************************
+function :	Number of bytes dropped because the ring was full
+parameter:
+******************************************************************************/
+UDOUBLE GNSS_UART_GetDropped(void)
+{
+    return GNSS_RxDropped;
+}
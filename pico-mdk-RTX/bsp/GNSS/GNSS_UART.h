@@ -0,0 +1,35 @@
+/*****************************************************************************
+* | File      	:   GNSS_UART.h
+* | Author      :   Noah Maceri
+* | Function    :   Interrupt driven UART receive path for the L76B GNSS module
+* | Info        :
+*                The UART RX interrupt empties the 32 byte hardware FIFO into
+*                a ring buffer and raises an event flag at the end of every
+*                line, threads read the ring without ever touching the UART
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __GNSS_UART_H
+#define __GNSS_UART_H
+
+#include "DEV_Config.h"
+#include "hardware/uart.h"
+#include "cmsis_os2.h"
+
+/**
+ * Ring buffer size, must be a power of two.
+ * One 400ms epoch of RMC+GGA+GSA+ZDA is ~320 bytes, this covers several epochs
+**/
+#define GNSS_RX_BUFFER_SIZE     1024
+#if (GNSS_RX_BUFFER_SIZE & (GNSS_RX_BUFFER_SIZE - 1)) != 0
+#error "GNSS_RX_BUFFER_SIZE must be a power of two"
+#endif
+
+UDOUBLE GNSS_UART_Init(uart_inst_t *Uart, UDOUBLE Baudrate, osEventFlagsId_t LineFlags, UDOUBLE LineFlag);
+bool GNSS_UART_Read(char *Ch);
+UDOUBLE GNSS_UART_GetDropped(void);
+
+#endif
@@ -0,0 +1,402 @@
+/*****************************************************************************
+* | File      	:   NMEA.c
+* | Author      :   Noah Maceri
+* | Function    :   NMEA 0183 sentence framing and field decoding for the L76B
+* | Info        :
+*                Bytes are pushed one at a time as they arrive on the UART,
+*                complete sentences are handed back without any fixed
+*                length or alignment assumptions. The checksum is folded in
+*                as bytes arrive so only intact sentences are handed back.
+*                Fields are decoded in place straight to fixed point integers
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "NMEA.h"
+#include <string.h>
+
+/******************************************************************************
+function :	Reset the framer, any partially collected sentence is dropped
+            and the link statistics are cleared
+parameter:
+    Framer : Framer to reset
+******************************************************************************/
+void NMEA_Framer_Init(NMEA_FRAMER *Framer)
+{
+    memset(Framer, 0, sizeof(NMEA_FRAMER));
+    Framer->State = NMEA_WAIT_START;
+}
+
+/******************************************************************************
+function :	Value of one hex checksum digit
+parameter:
+    Ch : '0'-'9', 'A'-'F' (or lower case)
+return   :  0-15, or -1 if Ch is not a hex digit
+******************************************************************************/
+static int NMEA_HexValue(char Ch)
+{
+    if(Ch >= '0' && Ch <= '9')
+        return Ch - '0';
+    if(Ch >= 'A' && Ch <= 'F')
+        return Ch - 'A' + 10;
+    if(Ch >= 'a' && Ch <= 'f')
+        return Ch - 'a' + 10;
+    return -1;
+}
+
+/******************************************************************************
+function :	Abandon the sentence being collected and count why
+parameter:
+    Framer : Framer holding the partial sentence
+    Reason : Counter to bump for the sentence's type
+******************************************************************************/
+static void NMEA_Framer_Drop(NMEA_FRAMER *Framer, UDOUBLE *Reason)
+{
+    (*Reason)++;
+    Framer->State = NMEA_WAIT_START;
+}
+
+/******************************************************************************
+function :	Push one received byte through the framer
+parameter:
+    Framer : Framer holding the partial sentence
+    Ch     : Byte read from the UART
+return   :  Pointer to the complete sentence ("$....*hh") once the terminating
+            LF arrives and the checksum matches, otherwise NULL. The pointer
+            stays valid until the next call with the same framer.
+******************************************************************************/
+const char *NMEA_Framer_Push(NMEA_FRAMER *Framer, char Ch)
+{
+    NMEA_COUNTERS *counters = &Framer->Counters[Framer->Type];
+    int nibble;
+
+    //'$' always starts a new sentence, this resynchronises after dropped bytes
+    if(Ch == '$') {
+        if(Framer->State != NMEA_WAIT_START) {
+            counters->Truncated++;
+        }
+        Framer->Sentence[0] = Ch;
+        Framer->Length = 1;
+        Framer->State = NMEA_BODY;
+        Framer->Type = NMEA_SENTENCE_UNKNOWN;
+        Framer->Checksum = 0;
+        return NULL;
+    }
+
+    switch(Framer->State) {
+    case NMEA_WAIT_START:
+        return NULL;
+    case NMEA_BODY:
+        if(Ch == '*') {
+            Framer->State = NMEA_CHECKSUM_HI;
+        } else if(Ch == '\r' || Ch == '\n') {
+            //Line ended without a checksum field
+            NMEA_Framer_Drop(Framer, &counters->Truncated);
+            return NULL;
+        } else {
+            Framer->Checksum ^= (UBYTE)Ch;
+            if(Ch == ',' && Framer->Type == NMEA_SENTENCE_UNKNOWN) {
+                Framer->Type = NMEA_Classify(&Framer->Sentence[1], Framer->Length - 1);
+            }
+        }
+        break;
+    case NMEA_CHECKSUM_HI:
+        nibble = NMEA_HexValue(Ch);
+        if(nibble < 0) {
+            NMEA_Framer_Drop(Framer, &counters->Truncated);
+            return NULL;
+        }
+        Framer->Received = (UBYTE)(nibble << 4);
+        Framer->State = NMEA_CHECKSUM_LO;
+        break;
+    case NMEA_CHECKSUM_LO:
+        nibble = NMEA_HexValue(Ch);
+        if(nibble < 0) {
+            NMEA_Framer_Drop(Framer, &counters->Truncated);
+            return NULL;
+        }
+        Framer->Received |= (UBYTE)nibble;
+        Framer->State = NMEA_WAIT_END;
+        break;
+    case NMEA_WAIT_END:
+        if(Ch == '\r') {
+            return NULL;
+        }
+        if(Ch != '\n') {
+            NMEA_Framer_Drop(Framer, &counters->Truncated);
+            return NULL;
+        }
+        if(Framer->Received != Framer->Checksum) {
+            NMEA_Framer_Drop(Framer, &counters->BadChecksum);
+            return NULL;
+        }
+        counters->Accepted++;
+        Framer->State = NMEA_WAIT_START;
+        Framer->Sentence[Framer->Length] = '\0';
+        return Framer->Sentence;
+    default:
+        Framer->State = NMEA_WAIT_START;
+        return NULL;
+    }
+
+    if(Framer->Length >= NMEA_MAX_SENTENCE) {
+        //Too long to be a valid sentence, wait for the next '$'
+        NMEA_Framer_Drop(Framer, &counters->Overrun);
+        return NULL;
+    }
+    Framer->Sentence[Framer->Length++] = Ch;
+    return NULL;
+}
+
+/**
+ * Address characters packed into one integer so recognition is a single
+ * switch rather than a chain of string compares
+**/
+#define NMEA_KEY2(a, b)     (((UWORD)(a) << 8) | (UWORD)(b))
+#define NMEA_KEY3(a, b, c)  (((UDOUBLE)(a) << 16) | ((UDOUBLE)(b) << 8) | (UDOUBLE)(c))
+
+/******************************************************************************
+function :	Work out which sentence an address field belongs to
+parameter:
+    Address : Address characters without the '$' ("GNGGA", "PMTK001")
+    Length  : Number of address characters
+info     :  Any talker is accepted, the sentence formatter is the last
+            three characters of a five character address
+******************************************************************************/
+NMEA_SENTENCE NMEA_Classify(const char *Address, UBYTE Length)
+{
+    if(Length >= 4 && Address[0] == 'P' && strncmp(Address, "PMTK", 4) == 0) {
+        return NMEA_SENTENCE_PMTK;
+    }
+    if(Length != 5) {
+        return NMEA_SENTENCE_UNKNOWN;
+    }
+    switch(NMEA_KEY3(Address[2], Address[3], Address[4])) {
+    case NMEA_KEY3('G', 'G', 'A'): return NMEA_SENTENCE_GGA;
+    case NMEA_KEY3('G', 'L', 'L'): return NMEA_SENTENCE_GLL;
+    case NMEA_KEY3('G', 'S', 'A'): return NMEA_SENTENCE_GSA;
+    case NMEA_KEY3('G', 'S', 'T'): return NMEA_SENTENCE_GST;
+    case NMEA_KEY3('G', 'S', 'V'): return NMEA_SENTENCE_GSV;
+    case NMEA_KEY3('R', 'M', 'C'): return NMEA_SENTENCE_RMC;
+    case NMEA_KEY3('V', 'T', 'G'): return NMEA_SENTENCE_VTG;
+    case NMEA_KEY3('Z', 'D', 'A'): return NMEA_SENTENCE_ZDA;
+    default:                       return NMEA_SENTENCE_UNKNOWN;
+    }
+}
+
+/******************************************************************************
+function :	Work out which constellation an address field came from
+parameter:
+    Address : Address characters without the '$'
+    Length  : Number of address characters
+******************************************************************************/
+NMEA_TALKER NMEA_GetTalker(const char *Address, UBYTE Length)
+{
+    if(Length < 2) {
+        return NMEA_TALKER_UNKNOWN;
+    }
+    switch(NMEA_KEY2(Address[0], Address[1])) {
+    case NMEA_KEY2('G', 'P'): return NMEA_TALKER_GP;
+    case NMEA_KEY2('G', 'L'): return NMEA_TALKER_GL;
+    case NMEA_KEY2('G', 'A'): return NMEA_TALKER_GA;
+    case NMEA_KEY2('G', 'B'):
+    case NMEA_KEY2('B', 'D'): return NMEA_TALKER_GB;
+    case NMEA_KEY2('G', 'N'): return NMEA_TALKER_GN;
+    default:                  return NMEA_TALKER_UNKNOWN;
+    }
+}
+
+/******************************************************************************
+function :	Link statistics for one sentence type
+parameter:
+    Framer : Framer the statistics were collected by
+    Type   : Sentence type
+******************************************************************************/
+const NMEA_COUNTERS *NMEA_GetCounters(const NMEA_FRAMER *Framer, NMEA_SENTENCE Type)
+{
+    if(Type >= NMEA_SENTENCE_COUNT) {
+        Type = NMEA_SENTENCE_UNKNOWN;
+    }
+    return &Framer->Counters[Type];
+}
+
+/******************************************************************************
+function :	Split a framed sentence into comma separated field spans
+parameter:
+    Sentence : "$TTSSS,f1,f2,...*hh" as returned by NMEA_Framer_Push
+    Fields   : Receives one span per field, pointing into Sentence
+return   :  Number of fields found (address included)
+info     :  Splitting stops at '*' or the end of the string, fields past
+            NMEA_MAX_FIELDS are ignored
+******************************************************************************/
+UBYTE NMEA_Split(const char *Sentence, NMEA_FIELDS *Fields)
+{
+    const char *start;
+    const char *p;
+    UBYTE count = 0;
+
+    if(*Sentence == '$') {
+        Sentence++;
+    }
+    start = Sentence;
+    for(p = Sentence; ; p++) {
+        if(*p == ',' || *p == '*' || *p == '\0') {
+            if(count < NMEA_MAX_FIELDS) {
+                Fields->Field[count].Ptr = start;
+                Fields->Field[count].Length = (UBYTE)(p - start);
+                count++;
+            }
+            if(*p != ',') {
+                break;
+            }
+            start = p + 1;
+        }
+    }
+    Fields->Count = count;
+    return count;
+}
+
+/******************************************************************************
+function :	Span of field N, empty if the sentence has fewer fields
+parameter:
+    Fields : Result of NMEA_Split
+    Index  : Field number, 0 is the address
+******************************************************************************/
+NMEA_FIELD NMEA_GetField(const NMEA_FIELDS *Fields, UBYTE Index)
+{
+    NMEA_FIELD empty = {"", 0};
+    if(Index >= Fields->Count) {
+        return empty;
+    }
+    return Fields->Field[Index];
+}
+
+/******************************************************************************
+function :	First character of field N, for single letter fields (N/S, E/W, fix)
+parameter:
+    Fields : Result of NMEA_Split
+    Index  : Field number, 0 is the address
+return   :  The character, or '\0' if the field is empty or missing
+******************************************************************************/
+char NMEA_GetChar(const NMEA_FIELDS *Fields, UBYTE Index)
+{
+    if(Index >= Fields->Count || Fields->Field[Index].Length == 0) {
+        return '\0';
+    }
+    return Fields->Field[Index].Ptr[0];
+}
+
+/******************************************************************************
+function :	Split a sentence and hand it to the decoder registered for its type
+parameter:
+    Sentence : "$TTSSS,...*hh" as returned by NMEA_Framer_Push
+    Decoders : Table indexed by NMEA_SENTENCE, NULL entries are ignored
+    Context  : Passed through to the decoder
+return   :  The sentence type
+info     :  Recognition is one switch on the packed address, the table
+            lookup is a single index, so adding types costs the others nothing
+******************************************************************************/
+NMEA_SENTENCE NMEA_Dispatch(const char *Sentence, const NMEA_DECODER Decoders[NMEA_SENTENCE_COUNT], void *Context)
+{
+    NMEA_FIELDS fields;
+    NMEA_SENTENCE type;
+    NMEA_TALKER talker;
+
+    if(NMEA_Split(Sentence, &fields) == 0) {
+        return NMEA_SENTENCE_UNKNOWN;
+    }
+    type = NMEA_Classify(fields.Field[0].Ptr, fields.Field[0].Length);
+    talker = NMEA_GetTalker(fields.Field[0].Ptr, fields.Field[0].Length);
+    if(Decoders[type] != NULL) {
+        Decoders[type](talker, &fields, Context);
+    }
+    return type;
+}
+
+/******************************************************************************
+function :	Decode a signed decimal field to a fixed point integer
+parameter:
+    Field    : First character of the field, inside the sentence buffer
+    Length   : Number of characters in the field
+    Decimals : Fractional digits to keep, "12.3" with 2 gives 1230
+    Value    : Where to store the result, untouched on failure
+return   :  false if the field is empty, not a number or does not fit an int32_t
+info     :  Extra fractional digits are truncated, missing ones are zero
+******************************************************************************/
+bool NMEA_ParseFixed(const char *Field, UBYTE Length, UBYTE Decimals, int32_t *Value)
+{
+    int32_t result = 0;
+    bool negative = false;
+    bool fraction = false;
+    bool digits = false;
+    UBYTE i = 0;
+
+    if(Length > 0 && (Field[0] == '-' || Field[0] == '+')) {
+        negative = (Field[0] == '-');
+        i++;
+    }
+    for(; i < Length; i++) {
+        char ch = Field[i];
+        if(ch == '.' && !fraction) {
+            fraction = true;
+        } else if(ch >= '0' && ch <= '9') {
+            digits = true;
+            if(fraction) {
+                if(Decimals == 0) {
+                    continue; //truncate
+                }
+                Decimals--;
+            }
+            if(result > (INT32_MAX - (ch - '0')) / 10) {
+                return false; //A corrupt or proprietary field with a valid checksum
+            }
+            result = result * 10 + (ch - '0');
+        } else {
+            return false;
+        }
+    }
+    if(!digits) {
+        return false;
+    }
+    while(Decimals--) {
+        if(result > INT32_MAX / 10) {
+            return false;
+        }
+        result *= 10;
+    }
+    *Value = negative ? -result : result;
+    return true;
+}
+
+/******************************************************************************
+function :	Decode a (d)ddmm.mmmm latitude/longitude field to microdegrees
+parameter:
+    Field        : First character of the field, inside the sentence buffer
+    Length       : Number of characters in the field
+    Hemisphere   : 'N', 'S', 'E' or 'W', south and west are negative
+    Microdegrees : Where to store the result, untouched on failure
+return   :  false if the field is empty or malformed
+******************************************************************************/
+bool NMEA_ParseCoordinate(const char *Field, UBYTE Length, char Hemisphere, int32_t *Microdegrees)
+{
+    int32_t degrees, minutes;
+    UBYTE intDigits = 0;
+
+    while(intDigits < Length && Field[intDigits] != '.') {
+        intDigits++;
+    }
+    if(intDigits < 3 || intDigits > 5) {
+        return false; //one to three degree digits and two minute digits
+    }
+    //Degrees are everything before the two whole minute digits
+    if(!NMEA_ParseFixed(Field, intDigits - 2, 0, &degrees) ||
+       !NMEA_ParseFixed(Field + intDigits - 2, Length - intDigits + 2, 5, &minutes)) {
+        return false;
+    }
+    //1 minute = 1/60 degree, minutes are in 1e-5 so 6 units make one microdegree
+    int32_t result = degrees * 1000000 + (minutes + 3) / 6;
+    *Microdegrees = (Hemisphere == 'S' || Hemisphere == 'W') ? -result : result;
+    return true;
+}
@@ -0,0 +1,127 @@
+/*****************************************************************************
+* | File      	:   NMEA.h
+* | Author      :   Noah Maceri
+* | Function    :   NMEA 0183 sentence framing and field decoding for the L76B
+* | Info        :
+*                Bytes are pushed one at a time as they arrive on the UART,
+*                complete sentences are handed back without any fixed
+*                length or alignment assumptions. The checksum is folded in
+*                as bytes arrive so only intact sentences are handed back.
+*                Fields are decoded in place straight to fixed point integers
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __NMEA_H
+#define __NMEA_H
+
+#include "DEV_Config.h"
+
+/**
+ * NMEA 0183 limits a sentence to 82 characters including '$' and CR/LF,
+ * leave some headroom for proprietary ($PMTK) replies
+**/
+#define NMEA_MAX_SENTENCE   96
+
+/**
+ * Framer state
+**/
+typedef enum {
+    NMEA_WAIT_START = 0,    // discarding bytes until '$'
+    NMEA_BODY,              // collecting address and fields
+    NMEA_CHECKSUM_HI,       // first hex digit after '*'
+    NMEA_CHECKSUM_LO,       // second hex digit after '*'
+    NMEA_WAIT_END,          // waiting for the terminating LF
+} NMEA_STATE;
+
+/**
+ * Talker, the first two address characters
+**/
+typedef enum {
+    NMEA_TALKER_UNKNOWN = 0,
+    NMEA_TALKER_GP,             // GPS
+    NMEA_TALKER_GL,             // GLONASS
+    NMEA_TALKER_GA,             // Galileo
+    NMEA_TALKER_GB,             // BeiDou (also sent as BD)
+    NMEA_TALKER_GN,             // Combined multi-constellation solution
+} NMEA_TALKER;
+
+/**
+ * Sentence types, the dispatch table and link statistics are indexed by these
+**/
+typedef enum {
+    NMEA_SENTENCE_UNKNOWN = 0,  // address not received yet, or not listed below
+    NMEA_SENTENCE_RMC,
+    NMEA_SENTENCE_GGA,
+    NMEA_SENTENCE_GSA,
+    NMEA_SENTENCE_GSV,
+    NMEA_SENTENCE_VTG,
+    NMEA_SENTENCE_ZDA,
+    NMEA_SENTENCE_GLL,
+    NMEA_SENTENCE_GST,
+    NMEA_SENTENCE_PMTK,         // command acknowledgements
+    NMEA_SENTENCE_COUNT,
+} NMEA_SENTENCE;
+
+/**
+ * Per sentence type link statistics
+**/
+typedef struct {
+    UDOUBLE Accepted;       // checksum matched, handed to the decoder
+    UDOUBLE BadChecksum;    // complete sentence, checksum mismatch
+    UDOUBLE Truncated;      // cut short by a new '$', a bare line end or a malformed checksum
+    UDOUBLE Overrun;        // longer than NMEA_MAX_SENTENCE
+} NMEA_COUNTERS;
+
+typedef struct {
+    char Sentence[NMEA_MAX_SENTENCE + 1]; // "$TTSSS,...*hh" null terminated, no CR/LF
+    UBYTE Length;
+    NMEA_STATE State;
+    NMEA_SENTENCE Type;                   // known once the address field is complete
+    UBYTE Checksum;                       // running XOR of the characters between '$' and '*'
+    UBYTE Received;                       // checksum sent by the module
+    NMEA_COUNTERS Counters[NMEA_SENTENCE_COUNT];
+} NMEA_FRAMER;
+
+/**
+ * Zero-copy view of one comma separated field inside a framed sentence.
+ * Field 0 is the address ("GNGGA"), an empty field has Length 0
+**/
+#define NMEA_MAX_FIELDS     24
+
+typedef struct {
+    const char *Ptr;
+    UBYTE Length;
+} NMEA_FIELD;
+
+typedef struct {
+    NMEA_FIELD Field[NMEA_MAX_FIELDS];
+    UBYTE Count;
+} NMEA_FIELDS;
+
+/**
+ * Sentence decoder, called with the split fields of a checksum-valid sentence
+**/
+typedef void (*NMEA_DECODER)(NMEA_TALKER Talker, const NMEA_FIELDS *Fields, void *Context);
+
+void NMEA_Framer_Init(NMEA_FRAMER *Framer);
+const char *NMEA_Framer_Push(NMEA_FRAMER *Framer, char Ch);
+NMEA_SENTENCE NMEA_Classify(const char *Address, UBYTE Length);
+NMEA_TALKER NMEA_GetTalker(const char *Address, UBYTE Length);
+const NMEA_COUNTERS *NMEA_GetCounters(const NMEA_FRAMER *Framer, NMEA_SENTENCE Type);
+
+//Field extraction
+UBYTE NMEA_Split(const char *Sentence, NMEA_FIELDS *Fields);
+NMEA_FIELD NMEA_GetField(const NMEA_FIELDS *Fields, UBYTE Index);
+char NMEA_GetChar(const NMEA_FIELDS *Fields, UBYTE Index);
+
+//Dispatch
+NMEA_SENTENCE NMEA_Dispatch(const char *Sentence, const NMEA_DECODER Decoders[NMEA_SENTENCE_COUNT], void *Context);
+
+//Field decoding, in place and integer only (no heap, no soft-float)
+bool NMEA_ParseFixed(const char *Field, UBYTE Length, UBYTE Decimals, int32_t *Value);
+bool NMEA_ParseCoordinate(const char *Field, UBYTE Length, char Hemisphere, int32_t *Microdegrees);
+
+#endif
@@ -0,0 +1,122 @@
+/*****************************************************************************
+* | File      	:   GUI_Core1.c
+* | Author      :   Noah Maceri
+* | Function    :   Runs render jobs on the second core
+* | Info        :
+*                RTX owns core 0. Core 1 runs a bare loop that takes a job
+*                from the SIO FIFO, runs it and pushes back its result. A
+*                job is posted without waiting, the SIO interrupt on core 0
+*                wakes whoever waits for the result
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "GUI_Core1.h"
+#include "pico/multicore.h"
+#include "hardware/irq.h"
+#include "cmsis_os2.h"
+
+#define CORE1_DONE_FLAG 0x00000001U
+
+static osEventFlagsId_t Core1_Flags = NULL;
+static osMutexId_t Core1_Mutex = NULL;   //One job in flight, the FIFO carries no job id
+static bool Core1_Busy = false;          //Posted job whose result nobody waited for yet
+static volatile UDOUBLE Core1_Result;
+
+/******************************************************************************
+function :	Core 1 entry, never returns. Jobs arrive as function pointers
+parameter:
+******************************************************************************/
+static void Core1_Main(void)
+{
+    while (1) {
+        CORE1_JOB Job = (CORE1_JOB)(uintptr_t)multicore_fifo_pop_blocking();
+        multicore_fifo_push_blocking(Job());
+    }
+}
+
+/******************************************************************************
+function :	SIO interrupt on core 0, core 1 pushed a result
+parameter:
+******************************************************************************/
+static void Core1_IRQHandler(void)
+{
+    while (multicore_fifo_rvalid()) {
+        Core1_Result = multicore_fifo_pop_blocking();
+        osEventFlagsSet(Core1_Flags, CORE1_DONE_FLAG);
+    }
+    multicore_fifo_clear_irq();
+}
+
+/******************************************************************************
+function :	Launch core 1, call once from an RTX thread on core 0
+parameter:
+return   :  false if the RTX objects could not be created
+******************************************************************************/
+bool Core1_Start(void)
+{
+    Core1_Flags = osEventFlagsNew(NULL);
+    Core1_Mutex = osMutexNew(NULL);
+    if (Core1_Flags == NULL || Core1_Mutex == NULL) {
+        return false;
+    }
+
+    //The launch handshake uses the FIFO, the interrupt may only take it over afterwards
+    multicore_launch_core1(Core1_Main);
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(SIO_IRQ_PROC0, Core1_IRQHandler);
+    irq_set_enabled(SIO_IRQ_PROC0, true);
+    return true;
+}
+
+/******************************************************************************
+function :	Wait for the job posted last, the calling thread sleeps until
+            it is done
+parameter:
+return   :  What the job returned, 0 if none was posted
+******************************************************************************/
+UDOUBLE Core1_Wait(void)
+{
+    UDOUBLE Result = 0;
+
+    osMutexAcquire(Core1_Mutex, osWaitForever);
+    if (Core1_Busy) {
+        osEventFlagsWait(Core1_Flags, CORE1_DONE_FLAG, osFlagsWaitAny, osWaitForever);
+        Core1_Busy = false;
+        Result = Core1_Result;
+    }
+    osMutexRelease(Core1_Mutex);
+    return Result;
+}
+
+/******************************************************************************
+function :	Start a job on core 1 and return at once. A job still running is
+            waited for first
+parameter:
+    Job : Function to run on core 1
+******************************************************************************/
+void Core1_Post(CORE1_JOB Job)
+{
+    osMutexAcquire(Core1_Mutex, osWaitForever);
+    if (Core1_Busy) {
+        osEventFlagsWait(Core1_Flags, CORE1_DONE_FLAG, osFlagsWaitAny, osWaitForever);
+    }
+    osEventFlagsClear(Core1_Flags, CORE1_DONE_FLAG);
+    Core1_Busy = true;
+    multicore_fifo_push_blocking((UDOUBLE)(uintptr_t)Job);
+    osMutexRelease(Core1_Mutex);
+}
+
+/******************************************************************************
+function :	Run a job on core 1, the calling thread sleeps until it is done
+parameter:
+    Job : Function to run on core 1
+return   :  What the job returned
+******************************************************************************/
+UDOUBLE Core1_Run(CORE1_JOB Job)
+{
+    Core1_Post(Job);
+    return Core1_Wait();
+}
@@ -0,0 +1,32 @@
+/*****************************************************************************
+* | File      	:   GUI_Core1.h
+* | Author      :   Noah Maceri
+* | Function    :   Runs render jobs on the second core
+* | Info        :
+*                RTX owns core 0. Core 1 runs a bare loop that takes a job
+*                from the SIO FIFO, runs it and pushes back its result. A
+*                job is posted without waiting, the SIO interrupt on core 0
+*                wakes whoever waits for the result
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __GUI_CORE1_H
+#define __GUI_CORE1_H
+
+#include "DEV_Config.h"
+
+/**
+ * A job runs on core 1 and must not call RTX. Everything it touches has to
+ * be left alone by core 0 until Core1_Wait returns
+**/
+typedef UDOUBLE (*CORE1_JOB)(void);
+
+bool Core1_Start(void);
+void Core1_Post(CORE1_JOB Job);
+UDOUBLE Core1_Wait(void);
+UDOUBLE Core1_Run(CORE1_JOB Job);
+
+#endif
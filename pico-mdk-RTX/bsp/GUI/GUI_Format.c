@@ -0,0 +1,199 @@
+/*****************************************************************************
+* | File      	:   GUI_Format.c
+* | Author      :   Noah Maceri
+* | Function    :   Integer and fixed-point to text without printf
+* | Info        :
+*                Every function writes into the caller's buffer, terminates
+*                it and returns a pointer to the terminator, so calls can be
+*                chained to compose a line. Digits come from a multiply by
+*                the reciprocal of ten, the M0+ has no divide instruction
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "GUI_Format.h"
+
+/******************************************************************************
+function :	Value / 10, exact for every 32 bit value
+parameter:
+    Value : Dividend
+return   :  Quotient
+******************************************************************************/
+static inline UDOUBLE Format_Div10(UDOUBLE Value)
+{
+    //0xCCCD / 2^19 is exact below 81920 and fits a 32 bit multiply,
+    //larger values need the full 0xCCCCCCCD / 2^35 and a 64 bit product
+    if (Value <= 0xFFFF) {
+        return (Value * 0xCCCDU) >> 19;
+    }
+    return (UDOUBLE)(((uint64_t)Value * 0xCCCCCCCDU) >> 35);
+}
+
+/******************************************************************************
+function :	Write the decimal digits of Value backwards from End
+parameter:
+    End      : One past the last digit
+    Value    : Number to write
+    MinDigits: Leading zeros are added up to this many digits
+return   :  First digit written
+******************************************************************************/
+static char *Format_Digits(char *End, UDOUBLE Value, UBYTE MinDigits)
+{
+    UBYTE Count = 0;
+
+    do {
+        UDOUBLE Quotient = Format_Div10(Value);
+        *--End = '0' + (char)(Value - Quotient * 10);
+        Value = Quotient;
+        Count++;
+    } while (Value != 0 || Count < MinDigits);
+    return End;
+}
+
+/******************************************************************************
+function :	Copy Width - Len pad characters and then Len characters from Src
+parameter:
+    Buf   : Destination
+    Src   : Characters to copy
+    Len   : Number of characters in Src
+    Width : Minimum field width
+    Pad   : Fill character
+return   :  Terminator of the written field
+******************************************************************************/
+static char *Format_Field(char *Buf, const char *Src, UBYTE Len, UBYTE Width, char Pad)
+{
+    while (Width > Len) {
+        *Buf++ = Pad;
+        Width--;
+    }
+    while (Len--) {
+        *Buf++ = *Src++;
+    }
+    *Buf = '\0';
+    return Buf;
+}
+
+/******************************************************************************
+function :	Append a string
+parameter:
+    Buf    : Destination
+    String : Zero terminated text
+return   :  Terminator of Buf
+******************************************************************************/
+char *Format_String(char *Buf, const char *String)
+{
+    while (*String) {
+        *Buf++ = *String++;
+    }
+    *Buf = '\0';
+    return Buf;
+}
+
+/******************************************************************************
+function :	Append one character
+parameter:
+    Buf : Destination
+    Ch  : Character
+return   :  Terminator of Buf
+******************************************************************************/
+char *Format_Char(char *Buf, char Ch)
+{
+    *Buf++ = Ch;
+    *Buf = '\0';
+    return Buf;
+}
+
+/******************************************************************************
+function :	Unsigned integer, like "%0*u" or "%*u"
+parameter:
+    Buf   : Destination, at least max(Width, FORMAT_UINT_MAX) + 1 bytes
+    Value : Number to write
+    Width : Minimum field width, 0 for none
+    Pad   : '0' or ' '
+return   :  Terminator of Buf
+******************************************************************************/
+char *Format_Uint(char *Buf, UDOUBLE Value, UBYTE Width, char Pad)
+{
+    char Digits[FORMAT_UINT_MAX];
+    char *First = Format_Digits(Digits + FORMAT_UINT_MAX, Value, 1);
+
+    return Format_Field(Buf, First, Digits + FORMAT_UINT_MAX - First, Width, Pad);
+}
+
+/******************************************************************************
+function :	Fixed-point number, Value is the number times 10^Decimals. The
+            field is padded like printf "%0*.*f", Format_Fixed(Buf, -520,
+            2, 5, '0') gives "-5.20" and Format_Fixed(Buf, 520, 2, 5, '0')
+            gives "05.20"
+parameter:
+    Buf      : Destination
+    Value    : Scaled number
+    Decimals : Digits after the point, 0 - 9
+    Width    : Minimum width of the whole field, sign and point included
+    Pad      : '0' goes between the sign and the digits, ' ' before the sign
+return   :  Terminator of Buf
+******************************************************************************/
+char *Format_Fixed(char *Buf, int32_t Value, UBYTE Decimals, UBYTE Width, char Pad)
+{
+    char Digits[FORMAT_UINT_MAX + 1];
+    char *End = Digits + sizeof(Digits);
+    UDOUBLE Magnitude = (Value < 0) ? 0U - (UDOUBLE)Value : (UDOUBLE)Value;
+    char *First = Format_Digits(End, Magnitude, Decimals + 1);
+    UBYTE Whole = End - First - Decimals;
+    UBYTE Length = (Value < 0) + Whole + (Decimals > 0 ? Decimals + 1 : 0);
+
+    for (; Pad == ' ' && Width > Length; Width--) {
+        *Buf++ = ' ';
+    }
+    if (Value < 0) {
+        *Buf++ = '-';
+    }
+    for (; Width > Length; Width--) {
+        *Buf++ = '0';
+    }
+    Buf = Format_Field(Buf, First, Whole, 0, Pad);
+    if (Decimals > 0) {
+        *Buf++ = '.';
+        Buf = Format_Field(Buf, First + Whole, Decimals, 0, Pad);
+    }
+    return Buf;
+}
+
+/******************************************************************************
+function :	Time of day, H:MM:SS or HH:MM:SS
+parameter:
+    Buf       : Destination, at least 9 bytes
+    Hour      : 0 - 23
+    Minute    : 0 - 59
+    Second    : 0 - 60
+    HourWidth : 2 zero pads single digit hours, 1 leaves them as one digit
+return   :  Terminator of Buf
+******************************************************************************/
+char *Format_Time(char *Buf, UBYTE Hour, UBYTE Minute, UBYTE Second, UBYTE HourWidth)
+{
+    Buf = Format_Uint(Buf, Hour, HourWidth, '0');
+    *Buf++ = ':';
+    Buf = Format_Uint(Buf, Minute, 2, '0');
+    *Buf++ = ':';
+    return Format_Uint(Buf, Second, 2, '0');
+}
+
+/******************************************************************************
+function :	Calendar date, MM/DD/YYYY
+parameter:
+    Buf   : Destination, at least 11 bytes
+    Month : 1 - 12
+    Day   : 1 - 31
+    Year  : Full year
+return   :  Terminator of Buf
+******************************************************************************/
+char *Format_Date(char *Buf, UBYTE Month, UBYTE Day, UWORD Year)
+{
+    Buf = Format_Uint(Buf, Month, 2, '0');
+    *Buf++ = '/';
+    Buf = Format_Uint(Buf, Day, 2, '0');
+    *Buf++ = '/';
+    return Format_Uint(Buf, Year, 2, '0');
+}
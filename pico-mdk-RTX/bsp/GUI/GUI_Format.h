@@ -0,0 +1,33 @@
+/*****************************************************************************
+* | File      	:   GUI_Format.h
+* | Author      :   Noah Maceri
+* | Function    :   Integer and fixed-point to text without printf
+* | Info        :
+*                Every function writes into the caller's buffer, terminates
+*                it and returns a pointer to the terminator, so calls can be
+*                chained to compose a line. Digits come from a multiply by
+*                the reciprocal of ten, the M0+ has no divide instruction
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __GUI_FORMAT_H
+#define __GUI_FORMAT_H
+
+#include "DEV_Config.h"
+
+/**
+ * Longest Format_Uint output without padding, 4294967295
+**/
+#define FORMAT_UINT_MAX     10
+
+char *Format_String(char *Buf, const char *String);
+char *Format_Char(char *Buf, char Ch);
+char *Format_Uint(char *Buf, UDOUBLE Value, UBYTE Width, char Pad);
+char *Format_Fixed(char *Buf, int32_t Value, UBYTE Decimals, UBYTE Width, char Pad);
+char *Format_Time(char *Buf, UBYTE Hour, UBYTE Minute, UBYTE Second, UBYTE HourWidth);
+char *Format_Date(char *Buf, UBYTE Month, UBYTE Day, UWORD Year);
+
+#endif
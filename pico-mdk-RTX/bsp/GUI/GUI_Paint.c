@@ -214,7 +214,7 @@ void Paint_Clear(UWORD Color)
         }
     }else if(Paint.Scale == 65) {
         for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
+            for (UWORD X = 0; X < Paint.WidthMemory; X++ ) {//1 pixel = 2 bytes, WidthByte is already in bytes
                 UDOUBLE Addr = X*2 + Y*Paint.WidthByte;
                 Paint.Image[Addr] = 0xff & (Color>>8);
                 Paint.Image[Addr+1] = 0xff & Color;
@@ -0,0 +1,483 @@
+/*****************************************************************************
+* | File      	:   GUI_Strip.c
+* | Author      :   Noah Maceri
+* | Function    :   Display list renderer for panels without a frame buffer
+* | Info        :
+*                A frame is recorded as a short list of fills and strings
+*                instead of being drawn into an image. On flush the list is
+*                compared with the previous frame, and only the rectangles
+*                that differ are replayed into a STRIP_ROWS high buffer and
+*                sent, one horizontal strip of the panel at a time.
+*                Colours are 4 bit indexes into a 16 colour palette, the
+*                strip is expanded to RGB565 a few rows at a time on its way
+*                to the panel
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "GUI_Strip.h"
+#include "Debug.h"
+#include <string.h>
+
+//Three lists, so the next frame can be recorded while one is flushed against the one on the panel
+static STRIP_OP Strip_Ops[STRIP_LISTS][STRIP_OPS_MAX];
+static UBYTE Strip_Count[STRIP_LISTS];
+static UBYTE Strip_Recording;   //List being recorded
+static UBYTE Strip_Pending;     //List handed over by Strip_Submit, sent by the next Strip_Flush
+static UBYTE Strip_Shown;       //List on the panel
+static UWORD Strip_Width, Strip_Height;
+static UWORD Strip_Xorigin, Strip_Yorigin;
+static bool Strip_All;          //Panel contents unknown, send everything
+
+static STRIP_RECT Strip_Dirty[STRIP_COUNT];
+//Palette indexes, two pixels a byte with the first in the high nibble. Rows are (area width / 2) bytes apart
+static UBYTE Strip_Buffer[STRIP_WIDTH_MAX * STRIP_ROWS / 2];
+//One entry per strip byte holding both of its pixels as RGB565 high byte first
+static uint32_t Strip_PaletteLut[256];
+//Rows expanded from the strip, one is filled while the other is still being sent
+static uint32_t Strip_Expand[2][STRIP_EXPAND_PIXELS / 2];
+static UBYTE Strip_Back;        //Expand buffer filled next
+
+/******************************************************************************
+function: Add an op to the list being recorded
+parameter:
+return   : Op to fill in, zeroed, or NULL when the list is full
+******************************************************************************/
+static STRIP_OP *Strip_Append(STRIP_OP_TYPE Type)
+{
+    STRIP_OP *Op;
+
+    if (Strip_Count[Strip_Recording] >= STRIP_OPS_MAX) {
+        Debug("Strip display list full, raise STRIP_OPS_MAX\r\n");
+        return NULL;
+    }
+    Op = &Strip_Ops[Strip_Recording][Strip_Count[Strip_Recording]++];
+    memset(Op, 0, sizeof(STRIP_OP));
+    Op->Type = Type;
+    return Op;
+}
+
+/******************************************************************************
+function: Record an area as changed in every strip it touches
+parameter:
+    Op : Op whose bounding box changed
+******************************************************************************/
+static void Strip_MarkDirty(const STRIP_OP *Op)
+{
+    UWORD Strip, Ystart, Yend;
+
+    for (Strip = Op->Ystart / STRIP_ROWS; Strip * STRIP_ROWS < Op->Yend; Strip++) {
+        STRIP_RECT *Rect = &Strip_Dirty[Strip];
+        Ystart = (Op->Ystart > Strip * STRIP_ROWS) ? Op->Ystart : Strip * STRIP_ROWS;
+        Yend = (Op->Yend < (Strip + 1) * STRIP_ROWS) ? Op->Yend : (Strip + 1) * STRIP_ROWS;
+        if (Rect->Xstart >= Rect->Xend) {
+            Rect->Xstart = Op->Xstart;
+            Rect->Ystart = Ystart;
+            Rect->Xend = Op->Xend;
+            Rect->Yend = Yend;
+        } else {
+            if (Op->Xstart < Rect->Xstart) Rect->Xstart = Op->Xstart;
+            if (Ystart < Rect->Ystart) Rect->Ystart = Ystart;
+            if (Op->Xend > Rect->Xend) Rect->Xend = Op->Xend;
+            if (Yend > Rect->Yend) Rect->Yend = Yend;
+        }
+    }
+}
+
+/******************************************************************************
+function: Set one pixel of a strip row
+parameter:
+    Row   : First byte of the row
+    X     : Pixel in the row
+    Index : Palette index
+******************************************************************************/
+static inline void Strip_SetIndex(UBYTE *Row, UWORD X, UBYTE Index)
+{
+    if (X & 1)
+        Row[X / 2] = (Row[X / 2] & 0xf0) | Index;
+    else
+        Row[X / 2] = (Row[X / 2] & 0x0f) | (Index << 4);
+}
+
+/******************************************************************************
+function: Draw the part of a fill inside the strip area
+parameter:
+    Op     : Fill
+    Area   : Panel area held by Buffer, Xstart and width even
+    Buffer : First byte of Area
+******************************************************************************/
+static void Strip_RenderFill(const STRIP_OP *Op, const STRIP_RECT *Area, UBYTE *Buffer)
+{
+    UWORD RowBytes = (Area->Xend - Area->Xstart) / 2;
+    UWORD Xstart = ((Op->Xstart > Area->Xstart) ? Op->Xstart : Area->Xstart) - Area->Xstart;
+    UWORD Ystart = (Op->Ystart > Area->Ystart) ? Op->Ystart : Area->Ystart;
+    UWORD Xend = ((Op->Xend < Area->Xend) ? Op->Xend : Area->Xend) - Area->Xstart;
+    UWORD Yend = (Op->Yend < Area->Yend) ? Op->Yend : Area->Yend;
+    UBYTE Index = Op->Foreground & 0x0f;
+    UWORD Y;
+
+    for (Y = Ystart; Y < Yend; Y++) {
+        UBYTE *Row = &Buffer[(Y - Area->Ystart) * RowBytes];
+        UWORD X = Xstart, End = Xend;
+        //Odd pixels at either end share a byte with their neighbour, whole bytes in between
+        if (X & 1)
+            Strip_SetIndex(Row, X++, Index);
+        if ((End & 1) && End > X)
+            Strip_SetIndex(Row, --End, Index);
+        if (End > X)
+            memset(&Row[X / 2], Index * 0x11, (End - X) / 2);
+    }
+}
+
+/******************************************************************************
+function: Draw the glyph rows and columns of a string inside the strip area.
+          Opaque text is written a byte (two pixels) at a time
+parameter:
+    Op     : String
+    Area   : Panel area held by Buffer, Xstart and width even
+    Buffer : First byte of Area
+******************************************************************************/
+static void Strip_RenderText(const STRIP_OP *Op, const STRIP_RECT *Area, UBYTE *Buffer)
+{
+    const sFONT *Font = Op->Font;
+    UWORD RowBytes = (Area->Xend - Area->Xstart) / 2;
+    UWORD FontBytes = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+    UWORD Page, Pend, Column, Cstart, Cend, Xchar, X;
+    UBYTE Ink = Op->Foreground & 0x0f, Paper = Op->Background & 0x0f;
+    bool Opaque = (FONT_BACKGROUND != Op->Background);
+    UBYTE Pair[4];
+    const char *Char;
+
+    //Two glyph bits, first pixel in bit 1, to the strip byte that shows them
+    Pair[0] = (Paper << 4) | Paper;
+    Pair[1] = (Paper << 4) | Ink;
+    Pair[2] = (Ink << 4) | Paper;
+    Pair[3] = (Ink << 4) | Ink;
+
+    Page = (Area->Ystart > Op->Ystart) ? Area->Ystart - Op->Ystart : 0;
+    Pend = ((Op->Yend < Area->Yend) ? Op->Yend : Area->Yend) - Op->Ystart;
+
+    for (Char = Op->Text, Xchar = Op->Xstart; *Char != '\0' && Xchar < Area->Xend; Char++, Xchar += Font->Width) {
+        if (Xchar + Font->Width <= Area->Xstart)
+            continue;
+        Cstart = (Area->Xstart > Xchar) ? Area->Xstart - Xchar : 0;
+        Cend = (Xchar + Font->Width > Area->Xend) ? Area->Xend - Xchar : Font->Width;
+
+        const unsigned char *Glyph = &Font->table[(*Char - ' ') * Font->Height * FontBytes];
+        UWORD Row;
+        for (Row = Page; Row < Pend; Row++) {
+            const unsigned char *Bits = &Glyph[Row * FontBytes];
+            UBYTE *Dst = &Buffer[(Op->Ystart + Row - Area->Ystart) * RowBytes];
+            Column = Cstart;
+            X = Xchar + Column - Area->Xstart;
+            if (Opaque) {
+                if (X & 1) {
+                    Strip_SetIndex(Dst, X++, (Bits[Column / 8] & (0x80 >> (Column % 8))) ? Ink : Paper);
+                    Column++;
+                }
+                for (; Column + 1 < Cend; Column += 2, X += 2) {
+                    UBYTE Two = (Column % 8 == 7) ? ((Bits[Column / 8] & 1) << 1) | (Bits[Column / 8 + 1] >> 7)
+                                                  : (Bits[Column / 8] >> (6 - Column % 8)) & 3;
+                    Dst[X / 2] = Pair[Two];
+                }
+                if (Column < Cend)
+                    Strip_SetIndex(Dst, X, (Bits[Column / 8] & (0x80 >> (Column % 8))) ? Ink : Paper);
+            } else {
+                for (; Column < Cend; Column++, X++) {
+                    if (Bits[Column / 8] & (0x80 >> (Column % 8)))
+                        Strip_SetIndex(Dst, X, Ink);
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************
+function: Expand strip rows to RGB565
+parameter:
+    Src   : First strip byte
+    Bytes : Strip bytes to expand, two pixels each
+    Dst   : Word aligned output, Bytes * 4 bytes
+******************************************************************************/
+static void Strip_ExpandRows(const UBYTE *Src, UDOUBLE Bytes, uint32_t *Dst)
+{
+    while (Bytes >= 4) {
+        Dst[0] = Strip_PaletteLut[Src[0]];
+        Dst[1] = Strip_PaletteLut[Src[1]];
+        Dst[2] = Strip_PaletteLut[Src[2]];
+        Dst[3] = Strip_PaletteLut[Src[3]];
+        Src += 4;
+        Dst += 4;
+        Bytes -= 4;
+    }
+    while (Bytes--) {
+        *Dst++ = Strip_PaletteLut[*Src++];
+    }
+}
+
+/******************************************************************************
+function: Set the panel size and forget what it shows
+parameter:
+    Width  : Panel width, at most STRIP_WIDTH_MAX, even
+    Height : Panel height, at most STRIP_HEIGHT_MAX
+******************************************************************************/
+void Strip_Init(UWORD Width, UWORD Height)
+{
+    Strip_Width = ((Width > STRIP_WIDTH_MAX) ? STRIP_WIDTH_MAX : Width) & ~1;
+    Strip_Height = (Height > STRIP_HEIGHT_MAX) ? STRIP_HEIGHT_MAX : Height;
+    Strip_Xorigin = 0;
+    Strip_Yorigin = 0;
+    memset(Strip_Count, 0, sizeof(Strip_Count));
+    Strip_Recording = 0;
+    Strip_Pending = 1;
+    Strip_Shown = 1;
+    Strip_All = true;
+}
+
+/******************************************************************************
+function: Set the colours of the 16 palette indexes. The whole panel is sent
+          again on the next flush, so swapping palettes (night mode) needs no
+          change to what the screens record. Not while a flush is running
+parameter:
+    Palette : STRIP_PALETTE_SIZE RGB565 colours, index 0 first. Index 0 also
+              shows wherever nothing was recorded
+******************************************************************************/
+void Strip_SetPalette(const UWORD *Palette)
+{
+    UWORD i;
+
+    for (i = 0; i < 256; i++) {
+        UWORD First = Palette[i >> 4], Second = Palette[i & 0x0f];
+        //Little endian word, bytes in memory are First high, First low, Second high, Second low
+        Strip_PaletteLut[i] = (uint32_t)(First >> 8) | (uint32_t)(First & 0xff) << 8 |
+                              (uint32_t)(Second >> 8) << 16 | (uint32_t)(Second & 0xff) << 24;
+    }
+    Strip_All = true;
+}
+
+/******************************************************************************
+function: Offset every coordinate recorded from now on, so a layout drawn for
+          a smaller area can be placed anywhere on the panel. Strip_Clear
+          always covers the whole panel
+parameter:
+    Xorigin, Yorigin : Panel position of layout (0, 0)
+******************************************************************************/
+void Strip_SetOrigin(UWORD Xorigin, UWORD Yorigin)
+{
+    Strip_Xorigin = Xorigin;
+    Strip_Yorigin = Yorigin;
+}
+
+/******************************************************************************
+function: Send the whole panel on the next flush, for after something else
+          has drawn on it
+parameter:
+******************************************************************************/
+void Strip_Invalidate(void)
+{
+    Strip_All = true;
+}
+
+/******************************************************************************
+function: Fill the whole panel, everything recorded before it is dropped
+parameter:
+    Color : Palette index
+******************************************************************************/
+void Strip_Clear(UWORD Color)
+{
+    STRIP_OP *Op;
+
+    Strip_Count[Strip_Recording] = 0; //Hidden under the fill
+    Op = Strip_Append(STRIP_OP_FILL);
+    Op->Xend = Strip_Width;
+    Op->Yend = Strip_Height;
+    Op->Foreground = Color;
+}
+
+/******************************************************************************
+function: Fill a window
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, exclusive
+    Yend   : y end point, exclusive
+    Color  : Palette index
+******************************************************************************/
+void Strip_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    STRIP_OP *Op;
+
+    Xstart += Strip_Xorigin;
+    Xend += Strip_Xorigin;
+    Ystart += Strip_Yorigin;
+    Yend += Strip_Yorigin;
+    if (Xend > Strip_Width) Xend = Strip_Width;
+    if (Yend > Strip_Height) Yend = Strip_Height;
+    if (Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    Op = Strip_Append(STRIP_OP_FILL);
+    if (Op == NULL)
+        return;
+    Op->Xstart = Xstart;
+    Op->Ystart = Ystart;
+    Op->Xend = Xend;
+    Op->Yend = Yend;
+    Op->Foreground = Color;
+}
+
+/******************************************************************************
+function: Display the string, wrapped like Paint_DrawString_EN
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Glyph cell palette index, as passed to Paint_DrawString_EN
+    Color_Background : Glyph palette index
+******************************************************************************/
+void Strip_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
+                         sFONT* Font, UWORD Color_Foreground, UWORD Color_Background)
+{
+    STRIP_OP *Op = NULL;
+    UWORD Xpoint, Ypoint;
+    UBYTE Length = 0;
+
+    Xstart += Strip_Xorigin;
+    Ystart += Strip_Yorigin;
+    if (Xstart > Strip_Width || Ystart > Strip_Height) {
+        Debug("Strip_DrawString_EN Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    Xpoint = Xstart;
+    Ypoint = Ystart;
+    while (*pString != '\0') {
+        if ((Xpoint + Font->Width) > Strip_Width) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+            Op = NULL;
+        }
+        if ((Ypoint + Font->Height) > Strip_Height) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+            Op = NULL;
+        }
+
+        //A new op on every line and whenever the text field is full
+        if (Op == NULL || Length == STRIP_TEXT_MAX - 1) {
+            Op = Strip_Append(STRIP_OP_TEXT);
+            if (Op == NULL)
+                return;
+            Op->Xstart = Xpoint;
+            Op->Ystart = Ypoint;
+            Op->Xend = Xpoint;
+            Op->Yend = Ypoint + Font->Height;
+            Op->Foreground = Color_Background;
+            Op->Background = Color_Foreground;
+            Op->Font = Font;
+            Length = 0;
+        }
+        Op->Text[Length++] = *pString;
+        Op->Xend += Font->Width;
+
+        pString++;
+        Xpoint += Font->Width;
+    }
+}
+
+/******************************************************************************
+function: End the frame being recorded and hand it to the next Strip_Flush.
+          Recording goes on in a list the flush does not read, so the next
+          frame can be recorded while this one is flushed, even from the
+          other core. Not while a flush is running
+parameter:
+******************************************************************************/
+void Strip_Submit(void)
+{
+    Strip_Pending = Strip_Recording;
+    Strip_Recording = (0 + 1 + 2) - Strip_Pending - Strip_Shown; //The third list
+    Strip_Count[Strip_Recording] = 0;
+}
+
+/******************************************************************************
+function: Send what changed between the submitted frame and the one on the
+          panel. Each strip with changes is rendered once, covering only the
+          columns that changed, and sent a few rows at a time as they are
+          expanded through the palette
+parameter:
+    Send : Writes one region to the panel. It may return while the data
+           is still being sent (DMA) as long as it waits for the previous
+           transfer before starting a new one, the two expand buffers
+           alternate so a buffer is never written while in flight
+return   : Bytes of pixel data sent
+******************************************************************************/
+UDOUBLE Strip_Flush(STRIP_FLUSH Send)
+{
+    const STRIP_OP *Frame = Strip_Ops[Strip_Pending];
+    const STRIP_OP *Shown = Strip_Ops[Strip_Shown];
+    UBYTE Count = Strip_Count[Strip_Pending];
+    UBYTE ShownCount = Strip_Count[Strip_Shown];
+    UDOUBLE Bytes = 0;
+    UBYTE i, Strip;
+
+    memset(Strip_Dirty, 0, sizeof(Strip_Dirty));
+    if (Strip_All) {
+        STRIP_OP All = {0};
+        All.Xend = Strip_Width;
+        All.Yend = Strip_Height;
+        Strip_MarkDirty(&All);
+        Strip_All = false;
+    } else {
+        //Ops are matched by position, a screen records the same sequence every frame
+        for (i = 0; i < Count || i < ShownCount; i++) {
+            if (i < Count && i < ShownCount && memcmp(&Frame[i], &Shown[i], sizeof(STRIP_OP)) == 0)
+                continue;
+            if (i < Count)
+                Strip_MarkDirty(&Frame[i]);
+            if (i < ShownCount)
+                Strip_MarkDirty(&Shown[i]);
+        }
+    }
+
+    for (Strip = 0; Strip < STRIP_COUNT; Strip++) {
+        STRIP_RECT *Area = &Strip_Dirty[Strip];
+        UWORD Width, Y, Rows;
+        if (Area->Xstart >= Area->Xend)
+            continue;
+
+        //Whole strip bytes, so rows start on a byte and expand to whole words
+        Area->Xstart &= ~1;
+        Area->Xend = (Area->Xend + 1) & ~1;
+        Width = Area->Xend - Area->Xstart;
+
+        //Uncovered pixels would otherwise show the previous strip
+        memset(Strip_Buffer, 0, (UDOUBLE)Width / 2 * (Area->Yend - Area->Ystart));
+        for (i = 0; i < Count; i++) {
+            const STRIP_OP *Op = &Frame[i];
+            if (Op->Xstart >= Area->Xend || Op->Xend <= Area->Xstart ||
+                Op->Ystart >= Area->Yend || Op->Yend <= Area->Ystart)
+                continue;
+            if (Op->Type == STRIP_OP_FILL)
+                Strip_RenderFill(Op, Area, Strip_Buffer);
+            else
+                Strip_RenderText(Op, Area, Strip_Buffer);
+        }
+
+        for (Y = Area->Ystart; Y < Area->Yend; Y += Rows) {
+            uint32_t *Expand = Strip_Expand[Strip_Back];
+            Rows = STRIP_EXPAND_PIXELS / Width;
+            if (Rows > Area->Yend - Y)
+                Rows = Area->Yend - Y;
+            Strip_ExpandRows(&Strip_Buffer[(Y - Area->Ystart) * (Width / 2)], (UDOUBLE)Rows * (Width / 2), Expand);
+            Send(Area->Xstart, Y, Area->Xend, Y + Rows, (const UBYTE *)Expand, Width * 2);
+            Strip_Back ^= 1;
+        }
+        Bytes += (UDOUBLE)Width * (Area->Yend - Area->Ystart) * 2;
+    }
+
+    Strip_Shown = Strip_Pending;
+    return Bytes;
+}
@@ -0,0 +1,90 @@
+/*****************************************************************************
+* | File      	:   GUI_Strip.h
+* | Author      :   Noah Maceri
+* | Function    :   Display list renderer for panels without a frame buffer
+* | Info        :
+*                A frame is recorded as a short list of fills and strings
+*                instead of being drawn into an image. On flush the list is
+*                compared with the previous frame, and only the rectangles
+*                that differ are replayed into a STRIP_ROWS high buffer and
+*                sent, one horizontal strip of the panel at a time.
+*                Colours are 4 bit indexes into a 16 colour palette, the
+*                strip is expanded to RGB565 a few rows at a time on its way
+*                to the panel
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __GUI_STRIP_H
+#define __GUI_STRIP_H
+
+#include "DEV_Config.h"
+#include "GUI_Paint.h"
+
+/**
+ * Strip buffer, STRIP_WIDTH_MAX * STRIP_ROWS / 2 bytes of palette indexes
+**/
+#define STRIP_WIDTH_MAX     240
+#define STRIP_HEIGHT_MAX    240
+#define STRIP_ROWS          20
+#define STRIP_COUNT         ((STRIP_HEIGHT_MAX + STRIP_ROWS - 1) / STRIP_ROWS)
+#define STRIP_PALETTE_SIZE  16
+#define STRIP_EXPAND_PIXELS 960     // 4 rows of 240, two RGB565 buffers of 1920 bytes
+
+/**
+ * Panel area, end exclusive
+**/
+typedef struct {
+    UWORD Xstart;
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+} STRIP_RECT;
+
+/**
+ * Sends one region, Image points at its first pixel (RGB565, high byte first)
+ * and rows are WidthByte apart
+**/
+typedef void (*STRIP_FLUSH)(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UBYTE *Image, UWORD WidthByte);
+
+/**
+ * Display list, three are kept (the frame being recorded, the one submitted
+ * for the next flush and the last one sent)
+**/
+#define STRIP_LISTS         3
+#define STRIP_OPS_MAX       24
+#define STRIP_TEXT_MAX      24      // longer strings are split over several ops
+
+typedef enum {
+    STRIP_OP_FILL = 1,
+    STRIP_OP_TEXT,
+} STRIP_OP_TYPE;
+
+typedef struct {
+    UBYTE Type;
+    UWORD Xstart;               // panel coordinates, end exclusive, already clipped
+    UWORD Ystart;
+    UWORD Xend;
+    UWORD Yend;
+    UWORD Foreground;           // fill colour or glyph ink, palette index
+    UWORD Background;           // glyph cell, FONT_BACKGROUND leaves it transparent
+    sFONT *Font;
+    char Text[STRIP_TEXT_MAX];  // zero padded, ops are compared with memcmp
+} STRIP_OP;
+
+void Strip_Init(UWORD Width, UWORD Height);
+void Strip_SetPalette(const UWORD *Palette);
+void Strip_SetOrigin(UWORD Xorigin, UWORD Yorigin);
+void Strip_Invalidate(void);
+
+//Recording, same arguments as the Paint_ functions of the same name, colours are palette indexes
+void Strip_Clear(UWORD Color);
+void Strip_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Strip_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString, sFONT* Font, UWORD Color_Foreground, UWORD Color_Background);
+
+void Strip_Submit(void);
+UDOUBLE Strip_Flush(STRIP_FLUSH Send);
+
+#endif
@@ -0,0 +1,143 @@
+/*****************************************************************************
+* | File      	:   Input_Keys.c
+* | Author      :   Noah Maceri
+* | Function    :   Debounced key events for the nine Waveshare keys
+* | Info        :
+*                A repeating timer samples every key, debounces it and
+*                turns the result into press, release, long press and
+*                auto-repeat events in a ring buffer that threads read
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "Input_Keys.h"
+#include "pico/time.h"
+
+#define INPUT_QUEUE_MASK    (INPUT_QUEUE_SIZE - 1)
+#define INPUT_TICKS(ms)     ((ms) / INPUT_SCAN_MS)
+
+static repeating_timer_t Input_Timer;
+static INPUT_NOTIFY Input_Notify;
+
+//Per key state, only touched by the timer interrupt
+static bool Input_Down[KEY_NUM];        //Debounced level
+static UBYTE Input_Lockout[KEY_NUM];    //Scans left before another change is accepted
+static UWORD Input_Held[KEY_NUM];       //Scans since the press, saturates
+
+//Single producer (timer IRQ) single consumer (reader thread), indices only ever grow
+static INPUT_EVENT Input_Queue[INPUT_QUEUE_SIZE];
+static volatile UBYTE Input_Head;
+static volatile UBYTE Input_Tail;
+static volatile UDOUBLE Input_Dropped;
+
+/******************************************************************************
+function :	Queue one event, the newest is dropped if the reader fell behind
+parameter:
+******************************************************************************/
+static bool Input_Push(UBYTE Key, INPUT_TYPE Type)
+{
+    UBYTE head = Input_Head;
+
+    if((UBYTE)(head - Input_Tail) >= INPUT_QUEUE_SIZE) {
+        Input_Dropped++;
+        return false;
+    }
+    Input_Queue[head & INPUT_QUEUE_MASK].Key = Key;
+    Input_Queue[head & INPUT_QUEUE_MASK].Type = Type;
+    Input_Head = head + 1;
+    return true;
+}
+
+/******************************************************************************
+function :	Timer interrupt, one pass over all keys. Bounded, no waiting
+parameter:
+******************************************************************************/
+static bool Input_Scan(repeating_timer_t *Timer)
+{
+    bool queued = false;
+    UBYTE key;
+
+    for(key = 0; key < KEY_NUM; key++) {
+        bool down = !dev_read_key(key); //Pulled up, pressed reads low
+
+        if(Input_Lockout[key] != 0) {
+            Input_Lockout[key]--;
+        } else if(down != Input_Down[key]) {
+            Input_Down[key] = down;
+            Input_Lockout[key] = INPUT_TICKS(INPUT_DEBOUNCE_MS);
+            Input_Held[key] = 0;
+            queued |= Input_Push(key, down ? INPUT_PRESS : INPUT_RELEASE);
+            continue;
+        }
+
+        if(!Input_Down[key] || Input_Held[key] == 0xFFFF) {
+            continue;
+        }
+        Input_Held[key]++;
+        if(Input_Held[key] == INPUT_TICKS(INPUT_LONG_MS)) {
+            queued |= Input_Push(key, INPUT_LONG);
+        }
+        if(Input_Held[key] >= INPUT_TICKS(INPUT_REPEAT_DELAY_MS) &&
+           (Input_Held[key] - INPUT_TICKS(INPUT_REPEAT_DELAY_MS)) % INPUT_TICKS(INPUT_REPEAT_MS) == 0) {
+            queued |= Input_Push(key, INPUT_REPEAT);
+        }
+    }
+
+    if(queued && Input_Notify != NULL) {
+        Input_Notify();
+    }
+    return true;
+}
+
+/******************************************************************************
+function :	Configure the key pins and start scanning
+parameter:
+    Notify : Called from the timer interrupt when events were queued (may be NULL)
+return   :  false if no alarm was free for the timer
+******************************************************************************/
+bool Input_Keys_Init(INPUT_NOTIFY Notify)
+{
+    UBYTE key;
+
+    Input_Notify = Notify;
+    Input_Head = 0;
+    Input_Tail = 0;
+    Input_Dropped = 0;
+    for(key = 0; key < KEY_NUM; key++) {
+        dev_key_init(key);
+        Input_Down[key] = false;
+        Input_Lockout[key] = 0;
+        Input_Held[key] = 0;
+    }
+
+    //Negative, the period runs from the start of one scan to the next
+    return add_repeating_timer_ms(-INPUT_SCAN_MS, Input_Scan, NULL, &Input_Timer);
+}
+
+/******************************************************************************
+function :	Take the oldest event out of the ring
+parameter:
+    Event : Where to store it
+return   :  false if there is none
+******************************************************************************/
+bool Input_Keys_Read(INPUT_EVENT *Event)
+{
+    UBYTE tail = Input_Tail;
+    if(tail == Input_Head) {
+        return false;
+    }
+    *Event = Input_Queue[tail & INPUT_QUEUE_MASK];
+    Input_Tail = tail + 1;
+    return true;
+}
+
+/******************************************************************************
+function :	Number of events dropped because the ring was full
+parameter:
+******************************************************************************/
+UDOUBLE Input_Keys_GetDropped(void)
+{
+    return Input_Dropped;
+}
@@ -0,0 +1,58 @@
+/*****************************************************************************
+* | File      	:   Input_Keys.h
+* | Author      :   Noah Maceri
+* | Function    :   Debounced key events for the nine Waveshare keys
+* | Info        :
+*                A repeating timer samples every key, debounces it and
+*                turns the result into press, release, long press and
+*                auto-repeat events in a ring buffer that threads read
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __INPUT_KEYS_H
+#define __INPUT_KEYS_H
+
+#include "DEV_Config.h"
+
+/**
+ * Timing, all in milliseconds and multiples of INPUT_SCAN_MS
+**/
+#define INPUT_SCAN_MS           2       // sample period, also the worst case press latency
+#define INPUT_DEBOUNCE_MS       10      // a change is reported at once, further changes are ignored this long
+#define INPUT_LONG_MS           1000    // held this long gives one INPUT_LONG
+#define INPUT_REPEAT_DELAY_MS   400     // held this long starts INPUT_REPEAT
+#define INPUT_REPEAT_MS         100     // then one INPUT_REPEAT this often
+
+/**
+ * Ring buffer size, must be a power of two
+**/
+#define INPUT_QUEUE_SIZE        16
+#if (INPUT_QUEUE_SIZE & (INPUT_QUEUE_SIZE - 1)) != 0
+#error "INPUT_QUEUE_SIZE must be a power of two"
+#endif
+
+typedef enum {
+    INPUT_PRESS = 1,
+    INPUT_RELEASE,
+    INPUT_LONG,
+    INPUT_REPEAT,
+} INPUT_TYPE;
+
+typedef struct {
+    UBYTE Key;      // KEY_HOME ... KEY_Y
+    UBYTE Type;     // INPUT_TYPE
+} INPUT_EVENT;
+
+/**
+ * Runs in the timer interrupt after a scan queued events, must not block
+**/
+typedef void (*INPUT_NOTIFY)(void);
+
+bool Input_Keys_Init(INPUT_NOTIFY Notify);
+bool Input_Keys_Read(INPUT_EVENT *Event);
+UDOUBLE Input_Keys_GetDropped(void);
+
+#endif
@@ -12,13 +12,50 @@
 *
 ******************************************************************************/
 #include "LCD_1in3.h"
+#include "LCD_1in3_PIO.h"
 #include "DEV_Config.h"
 
 #include <stdlib.h>		//itoa()
 #include <stdio.h>
+#include <string.h>
+#include "cmsis_os2.h"
 
 LCD_1IN3_ATTRIBUTES LCD_1IN3;
 
+static osEventFlagsId_t LCD_1IN3_Flags = NULL;   //LCD_1IN3_DMA_IDLE is raised when a DMA transfer ends, core 0 only
+static bool LCD_1IN3_DMA = false;                 //LCD_1IN3_DisplayRegionAsync hands the pixels to DMA
+static volatile bool LCD_1IN3_Busy = false;       //DMA transfer running, CS is held low
+static bool LCD_1IN3_PIO = false;                 //Transfers go through LCD_1in3_PIO instead of SPI and GPIO
+
+/******************************************************************************
+function :	DMA finished, runs in the DMA interrupt
+parameter:
+******************************************************************************/
+static void LCD_1IN3_DMA_Done(void)
+{
+    if (!LCD_1IN3_PIO) {
+        DEV_Digital_Write(EPD_CS_PIN, 1);
+    }
+    LCD_1IN3_Busy = false;
+    if (LCD_1IN3_Flags != NULL) {
+        osEventFlagsSet(LCD_1IN3_Flags, LCD_1IN3_DMA_IDLE);
+    }
+}
+
+/******************************************************************************
+function :	Wait for a DMA transfer to end, the thread sleeps on the event flag.
+            Without RTX (before the kernel starts, or on core 1) it spins
+parameter:
+******************************************************************************/
+void LCD_1IN3_WaitIdle(void)
+{
+    while (LCD_1IN3_Busy) {
+        if (LCD_1IN3_Flags != NULL && osKernelGetState() == osKernelRunning) {
+            osEventFlagsWait(LCD_1IN3_Flags, LCD_1IN3_DMA_IDLE, osFlagsWaitAny, osWaitForever);
+        }
+    }
+}
+
 
 /******************************************************************************
 function :	Hardware reset
@@ -35,125 +72,133 @@ static void LCD_1IN3_Reset(void)
 }
 
 /******************************************************************************
-function :	send command
+function :	Send a command and its parameters in one CS low transaction
 parameter:
-     Reg : Command register
+     Reg   : Command register
+     Param : Parameter bytes, sent with DC high
+     Len   : Number of parameter bytes, may be 0
 ******************************************************************************/
-static void LCD_1IN3_SendCommand(UBYTE Reg)
+static void LCD_1IN3_WriteCommand(UBYTE Reg, const UBYTE *Param, UBYTE Len)
 {
+    LCD_1IN3_WaitIdle();
+    if (LCD_1IN3_PIO) {
+        LCD_1IN3_PIO_Begin(false, 1);
+        LCD_1IN3_PIO_Write(&Reg, 1);
+        if (Len) {
+            LCD_1IN3_PIO_Begin(true, Len);
+            LCD_1IN3_PIO_Write(Param, Len);
+        }
+        return;
+    }
     DEV_Digital_Write(EPD_DC_PIN, 0);
     DEV_Digital_Write(EPD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Reg);
+    DEV_SPI_WriteByte(Reg);     //Blocks until shifted out, so DC can change
+    if (Len) {
+        DEV_Digital_Write(EPD_DC_PIN, 1);
+        DEV_SPI_Write_nByte((uint8_t *)Param, Len);
+    }
     DEV_Digital_Write(EPD_CS_PIN, 1);
 }
 
 /******************************************************************************
-function :	send data
+function :	Pixel data, after LCD_1IN3_SetWindows. Begin states how many
+            bytes the WriteData calls will add up to, the PIO needs it upfront
 parameter:
-    Data : Write data
 ******************************************************************************/
-static void LCD_1IN3_SendData_8Bit(UBYTE Data)
+static void LCD_1IN3_BeginData(UDOUBLE Len)
 {
+    LCD_1IN3_WaitIdle();
+    if (LCD_1IN3_PIO) {
+        LCD_1IN3_PIO_Begin(true, Len);
+        return;
+    }
     DEV_Digital_Write(EPD_DC_PIN, 1);
     DEV_Digital_Write(EPD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Data);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
 }
 
+static void LCD_1IN3_WriteData(const UBYTE *pData, UDOUBLE Len)
+{
+    if (LCD_1IN3_PIO) {
+        LCD_1IN3_PIO_Write(pData, Len);
+    } else {
+        DEV_SPI_Write_nByte((uint8_t *)pData, Len);
+    }
+}
+
+static void LCD_1IN3_EndData(void)
+{
+    if (!LCD_1IN3_PIO) {
+        DEV_Digital_Write(EPD_CS_PIN, 1);
+    }
+}
+
+/**
+ * Register values last sent, the panel forgets them on reset. Each one is
+ * valid only once it has been written since the last reset
+**/
+typedef struct {
+    bool Valid;
+    UBYTE Value[4];
+} LCD_1IN3_SHADOW;
+
+static LCD_1IN3_SHADOW LCD_1IN3_Madctl;
+static LCD_1IN3_SHADOW LCD_1IN3_Caset;
+static LCD_1IN3_SHADOW LCD_1IN3_Raset;
+
 /******************************************************************************
-function :	send data
+function :	Send a register only if it differs from what the panel holds
 parameter:
-    Data : Write data
+     Reg    : Command register
+     Shadow : Copy of the value last sent
+     Param  : New value
+     Len    : Number of bytes, up to 4
 ******************************************************************************/
-static void LCD_1IN3_SendData_16Bit(UWORD Data)
+static void LCD_1IN3_WriteShadowed(UBYTE Reg, LCD_1IN3_SHADOW *Shadow, const UBYTE *Param, UBYTE Len)
 {
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Data & 0xFF);
-    DEV_SPI_WriteByte((Data >> 8) & 0xFF);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    if (Shadow->Valid && memcmp(Shadow->Value, Param, Len) == 0) {
+        return;
+    }
+    memcpy(Shadow->Value, Param, Len);
+    Shadow->Valid = true;
+    LCD_1IN3_WriteCommand(Reg, Param, Len);
 }
 
+/**
+ * Initialisation, each entry is a command, its number of parameters and the parameters
+**/
+static const UBYTE LCD_1IN3_InitSequence[] = {
+    0x3A, 1, 0x05,
+    0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33,
+    0xB7, 1, 0x35,                  //Gate Control
+    0xBB, 1, 0x19,                  //VCOM Setting
+    0xC0, 1, 0x2C,                  //LCM Control
+    0xC2, 1, 0x01,                  //VDV and VRH Command Enable
+    0xC3, 1, 0x12,                  //VRH Set
+    0xC4, 1, 0x20,                  //VDV Set
+    0xC6, 1, 0x0F,                  //Frame Rate Control in Normal Mode
+    0xB0, 2, 0x00, 0xC8,
+    0xD0, 2, 0xA4, 0xA1,            // Power Control 1
+    0xE0, 14, 0xD0, 0x04, 0x0D, 0x11, 0x13, 0x2B, 0x3F,
+              0x54, 0x4C, 0x18, 0x0D, 0x0B, 0x1F, 0x23, //Positive Voltage Gamma Control
+    0xE1, 14, 0xD0, 0x04, 0x0C, 0x11, 0x13, 0x2C, 0x3F,
+              0x44, 0x51, 0x2F, 0x1F, 0x1F, 0x20, 0x23, //Negative Voltage Gamma Control
+    0x21, 0,                        //Display Inversion On
+    0x11, 0,                        //Sleep Out
+    0x29, 0,                        //Display On, stays on, frames do not resend it
+};
+
 /******************************************************************************
 function :	Initialize the lcd register
 parameter:
 ******************************************************************************/
 static void LCD_1IN3_InitReg(void)
 {
-    LCD_1IN3_SendCommand(0x3A);
-    LCD_1IN3_SendData_8Bit(0x05);
-
-    LCD_1IN3_SendCommand(0xB2);
-    LCD_1IN3_SendData_8Bit(0x0C);
-    LCD_1IN3_SendData_8Bit(0x0C);
-    LCD_1IN3_SendData_8Bit(0x00);
-    LCD_1IN3_SendData_8Bit(0x33);
-    LCD_1IN3_SendData_8Bit(0x33);
-
-    LCD_1IN3_SendCommand(0xB7);  //Gate Control
-    LCD_1IN3_SendData_8Bit(0x35);
-
-    LCD_1IN3_SendCommand(0xBB);  //VCOM Setting
-    LCD_1IN3_SendData_8Bit(0x19);
-
-    LCD_1IN3_SendCommand(0xC0); //LCM Control     
-    LCD_1IN3_SendData_8Bit(0x2C);
-
-    LCD_1IN3_SendCommand(0xC2);  //VDV and VRH Command Enable
-    LCD_1IN3_SendData_8Bit(0x01);
-    LCD_1IN3_SendCommand(0xC3);  //VRH Set
-    LCD_1IN3_SendData_8Bit(0x12);
-    LCD_1IN3_SendCommand(0xC4);  //VDV Set
-    LCD_1IN3_SendData_8Bit(0x20);
-
-    LCD_1IN3_SendCommand(0xC6);  //Frame Rate Control in Normal Mode
-    LCD_1IN3_SendData_8Bit(0x0F);
-    
-    LCD_1IN3_SendCommand(0xB0);
-    LCD_1IN3_SendData_8Bit(0x00);
-    LCD_1IN3_SendData_8Bit(0xC8);
-    
-    LCD_1IN3_SendCommand(0xD0);  // Power Control 1
-    LCD_1IN3_SendData_8Bit(0xA4);
-    LCD_1IN3_SendData_8Bit(0xA1);
-
-    LCD_1IN3_SendCommand(0xE0);  //Positive Voltage Gamma Control
-    LCD_1IN3_SendData_8Bit(0xD0);
-    LCD_1IN3_SendData_8Bit(0x04);
-    LCD_1IN3_SendData_8Bit(0x0D);
-    LCD_1IN3_SendData_8Bit(0x11);
-    LCD_1IN3_SendData_8Bit(0x13);
-    LCD_1IN3_SendData_8Bit(0x2B);
-    LCD_1IN3_SendData_8Bit(0x3F);
-    LCD_1IN3_SendData_8Bit(0x54);
-    LCD_1IN3_SendData_8Bit(0x4C);
-    LCD_1IN3_SendData_8Bit(0x18);
-    LCD_1IN3_SendData_8Bit(0x0D);
-    LCD_1IN3_SendData_8Bit(0x0B);
-    LCD_1IN3_SendData_8Bit(0x1F);
-    LCD_1IN3_SendData_8Bit(0x23);
-
-    LCD_1IN3_SendCommand(0xE1);  //Negative Voltage Gamma Control
-    LCD_1IN3_SendData_8Bit(0xD0);
-    LCD_1IN3_SendData_8Bit(0x04);
-    LCD_1IN3_SendData_8Bit(0x0C);
-    LCD_1IN3_SendData_8Bit(0x11);
-    LCD_1IN3_SendData_8Bit(0x13);
-    LCD_1IN3_SendData_8Bit(0x2C);
-    LCD_1IN3_SendData_8Bit(0x3F);
-    LCD_1IN3_SendData_8Bit(0x44);
-    LCD_1IN3_SendData_8Bit(0x51);
-    LCD_1IN3_SendData_8Bit(0x2F);
-    LCD_1IN3_SendData_8Bit(0x1F);
-    LCD_1IN3_SendData_8Bit(0x1F);
-    LCD_1IN3_SendData_8Bit(0x20);
-    LCD_1IN3_SendData_8Bit(0x23);
-
-    LCD_1IN3_SendCommand(0x21);  //Display Inversion On
-
-    LCD_1IN3_SendCommand(0x11);  //Sleep Out
-
-    LCD_1IN3_SendCommand(0x29);  //Display On
+    const UBYTE *Entry = LCD_1IN3_InitSequence;
+
+    while (Entry < LCD_1IN3_InitSequence + sizeof(LCD_1IN3_InitSequence)) {
+        LCD_1IN3_WriteCommand(Entry[0], &Entry[2], Entry[1]);
+        Entry += 2 + Entry[1];
+    }
 }
 
 /********************************************************************************
@@ -179,8 +224,7 @@ static void LCD_1IN3_SetAttributes(UBYTE Scan_dir)
     }
 
     // Set the read / write scan direction of the frame memory
-    LCD_1IN3_SendCommand(0x36); //MX, MY, RGB mode
-    LCD_1IN3_SendData_8Bit(MemoryAccessReg);	//0x08 set RGB
+    LCD_1IN3_WriteShadowed(0x36, &LCD_1IN3_Madctl, &MemoryAccessReg, 1); //MX, MY, RGB mode, 0x08 set RGB
 }
 
 /********************************************************************************
@@ -192,6 +236,9 @@ void LCD_1IN3_Init(UBYTE Scan_dir)
     DEV_SET_PWM(90);
     //Hardware reset
     LCD_1IN3_Reset();
+    LCD_1IN3_Madctl.Valid = false;
+    LCD_1IN3_Caset.Valid = false;
+    LCD_1IN3_Raset.Valid = false;
 
     //Set the resolution and scanning method of the screen
     LCD_1IN3_SetAttributes(Scan_dir);
@@ -205,27 +252,20 @@ function:	Sets the start position and size of the display area
 parameter:
 		Xstart 	:   X direction Start coordinates
 		Ystart  :   Y direction Start coordinates
-		Xend    :   X direction end coordinates
-		Yend    :   Y direction end coordinates
+		Xend    :   X direction end coordinates, exclusive
+		Yend    :   Y direction end coordinates, exclusive
 ********************************************************************************/
 void LCD_1IN3_SetWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
 {
-    //set the X coordinates
-    LCD_1IN3_SendCommand(0x2A);
-    LCD_1IN3_SendData_8Bit(0x00);
-    LCD_1IN3_SendData_8Bit(Xstart);
-	LCD_1IN3_SendData_8Bit(0x00);
-    LCD_1IN3_SendData_8Bit(Xend-1);
-
-    //set the Y coordinates
-    LCD_1IN3_SendCommand(0x2B);
-    LCD_1IN3_SendData_8Bit(0x00);
-	LCD_1IN3_SendData_8Bit(Ystart);
-	LCD_1IN3_SendData_8Bit(0x00);
-    LCD_1IN3_SendData_8Bit(Yend-1);
-
-    LCD_1IN3_SendCommand(0X2C);
-    // printf("%d %d\r\n",x,y);
+    UBYTE Caset[4] = {Xstart >> 8, Xstart & 0xFF, (Xend - 1) >> 8, (Xend - 1) & 0xFF};
+    UBYTE Raset[4] = {Ystart >> 8, Ystart & 0xFF, (Yend - 1) >> 8, (Yend - 1) & 0xFF};
+
+    //Strips and regions of the same width reuse the X range, only changes are sent
+    LCD_1IN3_WriteShadowed(0x2A, &LCD_1IN3_Caset, Caset, 4);
+    LCD_1IN3_WriteShadowed(0x2B, &LCD_1IN3_Raset, Raset, 4);
+
+    //Memory write, always sent as it moves the write pointer back to the window start
+    LCD_1IN3_WriteCommand(0x2C, NULL, 0);
 }
 
 /******************************************************************************
@@ -243,13 +283,12 @@ void LCD_1IN3_Clear(UWORD Color)
     }
     
     LCD_1IN3_SetWindows(0, 0, LCD_1IN3.WIDTH, LCD_1IN3.HEIGHT);
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
+    LCD_1IN3_BeginData((UDOUBLE)LCD_1IN3.WIDTH * LCD_1IN3.HEIGHT * 2);
 
     for(j = 0; j < LCD_1IN3.HEIGHT; j++){
-        DEV_SPI_Write_nByte((uint8_t *)Image, LCD_1IN3.WIDTH*2);
+        LCD_1IN3_WriteData((UBYTE *)Image, LCD_1IN3.WIDTH*2);
     }
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    LCD_1IN3_EndData();
 }
 
 /******************************************************************************
@@ -260,13 +299,11 @@ void LCD_1IN3_Display(UWORD *Image)
 {
     UWORD j;
     LCD_1IN3_SetWindows(0, 0, LCD_1IN3.WIDTH, LCD_1IN3.HEIGHT);
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
+    LCD_1IN3_BeginData((UDOUBLE)LCD_1IN3.WIDTH * LCD_1IN3.HEIGHT * 2);
     for (j = 0; j < LCD_1IN3.HEIGHT; j++) {
-        DEV_SPI_Write_nByte((uint8_t *)&Image[j*LCD_1IN3.WIDTH], LCD_1IN3.WIDTH*2);
+        LCD_1IN3_WriteData((UBYTE *)&Image[j*LCD_1IN3.WIDTH], LCD_1IN3.WIDTH*2);
     }
-    DEV_Digital_Write(EPD_CS_PIN, 1);
-    LCD_1IN3_SendCommand(0x29);
+    LCD_1IN3_EndData();
 }
 
 void GLCD_DrawBitmap(   int_fast16_t x, int_fast16_t y, 
@@ -275,13 +312,11 @@ void GLCD_DrawBitmap(   int_fast16_t x, int_fast16_t y,
 {
     UWORD j;
     LCD_1IN3_SetWindows(x, y, x+width, y+height);
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
+    LCD_1IN3_BeginData(height*width*2);
     
-    DEV_SPI_Write_nByte((uint8_t *)frame_ptr, height*width*2);
+    LCD_1IN3_WriteData((UBYTE *)frame_ptr, height*width*2);
     
-    DEV_Digital_Write(EPD_CS_PIN, 1);
-    LCD_1IN3_SendCommand(0x29);
+    LCD_1IN3_EndData();
 }
 
 void LCD_1IN3_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image)
@@ -291,17 +326,121 @@ void LCD_1IN3_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
 
     UWORD j;
     LCD_1IN3_SetWindows(Xstart, Ystart, Xend , Yend);
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
-    for (j = Ystart; j < Yend - 1; j++) {
+    LCD_1IN3_BeginData((UDOUBLE)(Xend - Xstart) * (Yend - Ystart) * 2);
+    for (j = Ystart; j < Yend; j++) {
         Addr = Xstart + j * LCD_1IN3.WIDTH ;
-        DEV_SPI_Write_nByte((uint8_t *)&Image[Addr], (Xend-Xstart)*2);
+        LCD_1IN3_WriteData((UBYTE *)&Image[Addr], (Xend-Xstart)*2);
+    }
+    LCD_1IN3_EndData();
+}
+
+/******************************************************************************
+function :	Sends one rectangle of a larger image, for partial refresh
+parameter:
+    Xstart, Ystart : Top left on the panel
+    Xend, Yend     : Bottom right on the panel, exclusive
+    Image          : First pixel of the rectangle (RGB565, high byte first)
+    WidthByte      : Distance between image rows in bytes
+******************************************************************************/
+void LCD_1IN3_DisplayRegion(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UBYTE *Image, UWORD WidthByte)
+{
+    UWORD j;
+    UDOUBLE RowBytes = (Xend - Xstart) * 2;
+
+    LCD_1IN3_SetWindows(Xstart, Ystart, Xend, Yend);
+    LCD_1IN3_BeginData(RowBytes * (Yend - Ystart));
+    if (RowBytes == WidthByte) {
+        //Full width rows are contiguous, one transfer
+        LCD_1IN3_WriteData(Image, RowBytes * (Yend - Ystart));
+    } else {
+        for (j = Ystart; j < Yend; j++) {
+            LCD_1IN3_WriteData(Image, RowBytes);
+            Image += WidthByte;
+        }
+    }
+    LCD_1IN3_EndData();
+}
+
+/******************************************************************************
+function :	Send everything through the PIO state machine from now on. Call
+            after LCD_1IN3_Init and before LCD_1IN3_DMA_Init
+parameter:
+return   :  false if the PIO has no room, the SPI path stays in use
+******************************************************************************/
+bool LCD_1IN3_UsePIO(void)
+{
+    LCD_1IN3_WaitIdle();
+    LCD_1IN3_PIO = LCD_1IN3_PIO_Init();
+    return LCD_1IN3_PIO;
+}
+
+/******************************************************************************
+function :	Claim a DMA channel for LCD_1IN3_DisplayRegionAsync. The DMA
+            interrupt is enabled on the calling core, so call it from the core
+            that sends frames. On core 0 it needs the RTX kernel, on core 1
+            waits spin instead of sleeping
+parameter:
+return   :  false if no channel was free, async sends then fall back to blocking
+******************************************************************************/
+bool LCD_1IN3_DMA_Init(void)
+{
+    if (get_core_num() == 0) {
+        LCD_1IN3_Flags = osEventFlagsNew(NULL);
+        if (LCD_1IN3_Flags == NULL) {
+            return false;
+        }
+    }
+    if (LCD_1IN3_PIO ? !LCD_1IN3_PIO_DMA_Init(LCD_1IN3_DMA_Done) : !DEV_SPI_DMA_Init(LCD_1IN3_DMA_Done)) {
+        if (LCD_1IN3_Flags != NULL) {
+            osEventFlagsDelete(LCD_1IN3_Flags);
+            LCD_1IN3_Flags = NULL;
+        }
+        return false;
+    }
+    LCD_1IN3_DMA = true;
+    return true;
+}
+
+/******************************************************************************
+function :	LCD_1IN3_DisplayRegion that returns as soon as the pixel data is
+            handed to DMA. Image must stay untouched until the next LCD call
+            or LCD_1IN3_WaitIdle, every LCD function waits for the transfer
+            before touching the bus. Regions whose rows are not contiguous
+            are sent blocking
+parameter:
+    Xstart, Ystart : Top left on the panel
+    Xend, Yend     : Bottom right on the panel, exclusive
+    Image          : First pixel of the rectangle (RGB565, high byte first)
+    WidthByte      : Distance between image rows in bytes
+******************************************************************************/
+void LCD_1IN3_DisplayRegionAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UBYTE *Image, UWORD WidthByte)
+{
+    UDOUBLE RowBytes = (Xend - Xstart) * 2;
+
+    if (!LCD_1IN3_DMA || RowBytes != WidthByte) {
+        LCD_1IN3_DisplayRegion(Xstart, Ystart, Xend, Yend, Image, WidthByte);
+        return;
+    }
+
+    LCD_1IN3_SetWindows(Xstart, Ystart, Xend, Yend);
+    LCD_1IN3_BeginData(RowBytes * (Yend - Ystart));
+    if (LCD_1IN3_Flags != NULL) {
+        osEventFlagsClear(LCD_1IN3_Flags, LCD_1IN3_DMA_IDLE);
+    }
+    LCD_1IN3_Busy = true;
+    if (LCD_1IN3_PIO) {
+        LCD_1IN3_PIO_Write_DMA(Image, RowBytes * (Yend - Ystart));
+    } else {
+        DEV_SPI_Write_DMA(Image, RowBytes * (Yend - Ystart));
     }
-    DEV_Digital_Write(EPD_CS_PIN, 1);
 }
 
 void LCD_1IN3_DisplayPoint(UWORD X, UWORD Y, UWORD Color)
 {
-    LCD_1IN3_SetWindows(X,Y,X,Y);
-    LCD_1IN3_SendData_16Bit(Color);
+    UBYTE Pixel[2] = {Color >> 8, Color & 0xFF};   //RGB565 high byte first, as the images are
+
+    LCD_1IN3_SetWindows(X, Y, X + 1, Y + 1);
+    LCD_1IN3_BeginData(2);
+    LCD_1IN3_WriteData(Pixel, 2);
+    LCD_1IN3_EndData();
 }
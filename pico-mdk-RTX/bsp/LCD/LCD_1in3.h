@@ -28,6 +28,8 @@
 #define HORIZONTAL 0
 #define VERTICAL   1
 
+#define LCD_1IN3_DMA_IDLE 0x00000001U //Event flag raised when an async transfer ends
+
 #define LCD_1IN3_SetBacklight(Value) ; 
 
 
@@ -46,6 +48,11 @@ void LCD_1IN3_Init(UBYTE Scan_dir);
 void LCD_1IN3_Clear(UWORD Color);
 void LCD_1IN3_Display(UWORD *Image);
 void LCD_1IN3_DisplayWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD *Image);
+void LCD_1IN3_DisplayRegion(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UBYTE *Image, UWORD WidthByte);
+bool LCD_1IN3_UsePIO(void);
+bool LCD_1IN3_DMA_Init(void);
+void LCD_1IN3_DisplayRegionAsync(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, const UBYTE *Image, UWORD WidthByte);
+void LCD_1IN3_WaitIdle(void);
 void LCD_1IN3_DisplayPoint(UWORD X, UWORD Y, UWORD Color);
 
 extern 
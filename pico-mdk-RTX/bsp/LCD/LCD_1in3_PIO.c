@@ -0,0 +1,144 @@
+/*****************************************************************************
+* | File      	:   LCD_1in3_PIO.c
+* | Author      :   Noah Maceri
+* | Function    :   PIO transport for the 1.3inch LCD
+* | Info        :
+*                Replaces the SPI peripheral and the DC/CS GPIO writes with
+*                a PIO state machine that frames every transfer itself.
+*                Selected at run time with LCD_1IN3_UsePIO.
+*                Not tested on hardware yet, SPI stays the default
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#include "LCD_1in3_PIO.h"
+#include "LCD_1in3_PIO.pio.h"
+#include "hardware/clocks.h"
+#include "hardware/irq.h"
+
+#define LCD_PIO pio0
+
+static int LCD_PIO_SM = -1;
+static int LCD_PIO_DMA_Channel = -1;
+static LCD_1IN3_PIO_DONE LCD_PIO_Done;
+
+/******************************************************************************
+function :	Load the program and hand DC, CS, SCK and MOSI to the state machine.
+            EPD_DC_PIN and EPD_CS_PIN must be consecutive, DEV_Module_Init
+            has already run
+parameter:
+return   :  false if no state machine or program space was free
+******************************************************************************/
+bool LCD_1IN3_PIO_Init(void)
+{
+    pio_sm_config Config;
+    uint Offset;
+    UDOUBLE Div;
+
+    if (!pio_can_add_program(LCD_PIO, &lcd_1in3_program)) {
+        return false;
+    }
+    LCD_PIO_SM = pio_claim_unused_sm(LCD_PIO, false);
+    if (LCD_PIO_SM < 0) {
+        return false;
+    }
+    Offset = pio_add_program(LCD_PIO, &lcd_1in3_program);
+
+    //Idle levels before the pins switch over, CS high and SCK low
+    pio_sm_set_pins_with_mask(LCD_PIO, LCD_PIO_SM, 1u << EPD_CS_PIN,
+                              (1u << EPD_DC_PIN) | (1u << EPD_CS_PIN) | (1u << EPD_CLK_PIN) | (1u << EPD_MOSI_PIN));
+    pio_sm_set_pindirs_with_mask(LCD_PIO, LCD_PIO_SM, ~0u,
+                                 (1u << EPD_DC_PIN) | (1u << EPD_CS_PIN) | (1u << EPD_CLK_PIN) | (1u << EPD_MOSI_PIN));
+    pio_gpio_init(LCD_PIO, EPD_DC_PIN);
+    pio_gpio_init(LCD_PIO, EPD_CS_PIN);
+    pio_gpio_init(LCD_PIO, EPD_CLK_PIN);
+    pio_gpio_init(LCD_PIO, EPD_MOSI_PIN);
+
+    Config = lcd_1in3_program_get_default_config(Offset);
+    sm_config_set_set_pins(&Config, EPD_DC_PIN, 2);
+    sm_config_set_out_pins(&Config, EPD_MOSI_PIN, 1);
+    sm_config_set_sideset_pins(&Config, EPD_CLK_PIN);
+    sm_config_set_out_shift(&Config, false, true, 8);
+    sm_config_set_fifo_join(&Config, PIO_FIFO_JOIN_TX);
+    //Two PIO cycles per bit
+    Div = (clock_get_hz(clk_sys) + 2 * LCD_1IN3_PIO_SCK_HZ - 1) / (2 * LCD_1IN3_PIO_SCK_HZ);
+    sm_config_set_clkdiv_int_frac(&Config, Div ? Div : 1, 0);
+
+    pio_sm_init(LCD_PIO, LCD_PIO_SM, Offset, &Config);
+    pio_sm_set_enabled(LCD_PIO, LCD_PIO_SM, true);
+    return true;
+}
+
+/******************************************************************************
+function :	Start a transfer, the state machine lowers CS when its first bit
+            goes out and raises it after the last
+parameter:
+    Data : DC level, false for a command byte
+    Len  : Bytes that follow, written with LCD_1IN3_PIO_Write(_DMA)
+******************************************************************************/
+void LCD_1IN3_PIO_Begin(bool Data, UDOUBLE Len)
+{
+    if (Len == 0) {
+        return;     //A zero length header would ask for 2^31 bits
+    }
+    pio_sm_put_blocking(LCD_PIO, LCD_PIO_SM, (Data ? 0x80000000u : 0) | (Len * 8 - 1));
+}
+
+/******************************************************************************
+function :	Queue bytes of the current transfer, returns once they are all in
+            the FIFO
+parameter:
+******************************************************************************/
+void LCD_1IN3_PIO_Write(const UBYTE *pData, UDOUBLE Len)
+{
+    while (Len--) {
+        pio_sm_put_blocking(LCD_PIO, LCD_PIO_SM, (uint32_t)*pData++ << 24);
+    }
+}
+
+/**
+ * DMA into the state machine FIFO. Done runs in the DMA interrupt once the
+ * last byte is in the FIFO, the buffer is free from then on
+**/
+static void LCD_1IN3_PIO_DMA_IRQHandler(void)
+{
+    if ((dma_hw->ints0 & (1u << LCD_PIO_DMA_Channel)) == 0) {
+        return;
+    }
+    dma_hw->ints0 = 1u << LCD_PIO_DMA_Channel;
+
+    if (LCD_PIO_Done != NULL) {
+        LCD_PIO_Done();
+    }
+}
+
+bool LCD_1IN3_PIO_DMA_Init(LCD_1IN3_PIO_DONE Done)
+{
+    dma_channel_config Config;
+
+    LCD_PIO_DMA_Channel = dma_claim_unused_channel(false);
+    if (LCD_PIO_DMA_Channel < 0) {
+        return false;
+    }
+    LCD_PIO_Done = Done;
+
+    //8-bit writes to the FIFO land in every byte lane, so bits 31..24 as the program expects
+    Config = dma_channel_get_default_config(LCD_PIO_DMA_Channel);
+    channel_config_set_transfer_data_size(&Config, DMA_SIZE_8);
+    channel_config_set_read_increment(&Config, true);
+    channel_config_set_write_increment(&Config, false);
+    channel_config_set_dreq(&Config, pio_get_dreq(LCD_PIO, LCD_PIO_SM, true));
+    dma_channel_configure(LCD_PIO_DMA_Channel, &Config, &LCD_PIO->txf[LCD_PIO_SM], NULL, 0, false);
+
+    dma_channel_set_irq0_enabled(LCD_PIO_DMA_Channel, true);
+    irq_add_shared_handler(DMA_IRQ_0, LCD_1IN3_PIO_DMA_IRQHandler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+    return true;
+}
+
+void LCD_1IN3_PIO_Write_DMA(const UBYTE *pData, UDOUBLE Len)
+{
+    dma_channel_transfer_from_buffer_now(LCD_PIO_DMA_Channel, pData, Len);
+}
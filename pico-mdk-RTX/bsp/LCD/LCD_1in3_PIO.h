@@ -0,0 +1,37 @@
+/*****************************************************************************
+* | File      	:   LCD_1in3_PIO.h
+* | Author      :   Noah Maceri
+* | Function    :   PIO transport for the 1.3inch LCD
+* | Info        :
+*                Replaces the SPI peripheral and the DC/CS GPIO writes with
+*                a PIO state machine that frames every transfer itself.
+*                Selected at run time with LCD_1IN3_UsePIO.
+*                Not tested on hardware yet, SPI stays the default
+*----------------
+* |	This version:   V1.0
+* | Date        :   2026-10-17
+* | Info        :   Basic version
+*
+******************************************************************************/
+#ifndef __LCD_1IN3_PIO_H
+#define __LCD_1IN3_PIO_H
+
+#include "DEV_Config.h"
+
+/**
+ * Fastest serial clock, the ST7789 write cycle is 16ns. The divider is
+ * rounded up, at 250MHz the clock is 62.5MHz
+**/
+#ifndef LCD_1IN3_PIO_SCK_HZ
+#define LCD_1IN3_PIO_SCK_HZ     62500000
+#endif
+
+typedef void (*LCD_1IN3_PIO_DONE)(void);
+
+bool LCD_1IN3_PIO_Init(void);
+bool LCD_1IN3_PIO_DMA_Init(LCD_1IN3_PIO_DONE Done);
+void LCD_1IN3_PIO_Begin(bool Data, UDOUBLE Len);
+void LCD_1IN3_PIO_Write(const UBYTE *pData, UDOUBLE Len);
+void LCD_1IN3_PIO_Write_DMA(const UBYTE *pData, UDOUBLE Len);
+
+#endif
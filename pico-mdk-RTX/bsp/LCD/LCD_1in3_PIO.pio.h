@@ -0,0 +1,47 @@
+// ------------------------------------------------------------------ //
+// Hand encoded from LCD_1in3_PIO.pio in the layout pioasm produces.   //
+// Keil has no pioasm step: any change to the .pio source must be      //
+// encoded here by hand. Not tested on hardware.                       //
+// ------------------------------------------------------------------ //
+
+#pragma once
+
+#if !PICO_NO_HARDWARE
+#include "hardware/pio.h"
+#endif
+
+// -------- //
+// lcd_1in3 //
+// -------- //
+
+#define lcd_1in3_wrap_target 0
+#define lcd_1in3_wrap 8
+
+static const uint16_t lcd_1in3_program_instructions[] = {
+            //     .wrap_target
+    0xe002, //  0: set    pins, 2         side 0
+    0x6021, //  1: out    x, 1            side 0
+    0x605f, //  2: out    y, 31           side 0
+    0x0026, //  3: jmp    !x, 6           side 0
+    0xe001, //  4: set    pins, 1         side 0
+    0x0007, //  5: jmp    7               side 0
+    0xe000, //  6: set    pins, 0         side 0
+    0x6001, //  7: out    pins, 1         side 0
+    0x1087, //  8: jmp    y--, 7          side 1
+            //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program lcd_1in3_program = {
+    .instructions = lcd_1in3_program_instructions,
+    .length = 9,
+    .origin = -1,
+};
+
+static inline pio_sm_config lcd_1in3_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + lcd_1in3_wrap_target, offset + lcd_1in3_wrap);
+    sm_config_set_sideset(&c, 1, false, false);
+    return c;
+}
+#endif
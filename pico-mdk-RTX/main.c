@@ -13,6 +13,16 @@
 #include "LCD_1In3.h"
 #include "GLCD_Config.h"
 #include "GUI_Paint.h"
+#include "GUI_Strip.h"
+#include "GUI_Core1.h"
+#include "GUI_Format.h"
+//GNSS Specifics
+#include "NMEA.h"
+#include "GNSS_UART.h"
+#include "GNSS_Epoch.h"
+#include "GNSS_Time.h"
+//Input Specifics
+#include "Input_Keys.h"
 //Keil Specifics
 #include "perf_counter.h"
 #include <EventRecorder.h>
@@ -29,51 +39,56 @@
 #define UDOUBLE uint32_t
 #define DOUBLE  int32_t
 //LCD Configs
-#define xSize 			168
+#define xSize 			168 //Screen layouts, centered on the 240x240 panel
 #define ySize				168
 #define	sqOffset		36
 //UART
 #define UART_ID 		uart0
 #define UART_TX_PIN 0
 #define UART_RX_PIN 1
-#define BUFFSIZE 107
+#define GNSS_LINE_FLAG 0x00000001U
+#define GNSS_PPS_PIN 22 //L76B 1PPS output, rising edge at the start of each UTC second
+#define GNSS_EPOCH_SENTENCES (GNSS_EPOCH_BIT(NMEA_SENTENCE_RMC) | GNSS_EPOCH_BIT(NMEA_SENTENCE_GGA) | GNSS_EPOCH_BIT(NMEA_SENTENCE_GSA) | GNSS_EPOCH_BIT(NMEA_SENTENCE_ZDA)) //Must match SET_NMEA_OUTPUT
+//UI
+#define UI_QUEUE_LEN      8  //Events waiting for the UI thread, a full queue drops them (a frame is already due)
+#define RENDER_FRAME_MS   17 //One panel refresh (ST7789 0xC6 = 0x0F, 60Hz), events closer than this share a frame
 //Device
 #define SYS_CLOCK_SPEED 250000
 
 /*FUNCTION DEFINITIONS*/
 extern void SystemCoreClockUpdate();
-char* UART_RX();
+const char* UART_RX();
 const char* getStatusName(DOUBLE osStatus);
 void setup_GNSS();
 void L76X_Update();
-void location_screen();
-void clock_screen();
-void techdata_screen();
+void gnss_ingest();
+void flush_frame();
+UDOUBLE lcd_dma_job();
+UDOUBLE flush_job();
+void draw_centered(UWORD y, const char *text, sFONT *font, UWORD background, UWORD foreground);
+void draw_lock(UBYTE lock_type);
+void ui_thread();
 void gpio_callback(uint gpio, uint32_t events);
+void input_notify();
 void system_info();
 
 /*RTX Specific Configurations*/
 //Threads
 osThreadId_t setup_TID;    
-osThreadId_t clock_screen_TID;
-osThreadId_t location_screen_TID;
-osThreadId_t techdata_screen_TID;
+osThreadId_t gnss_ingest_TID;
+osThreadId_t ui_TID;
 
 const osThreadAttr_t setup_attr = {
 	.name = "SETUP_THREAD",
 	.priority = osPriorityAboveNormal
 };
-const osThreadAttr_t clock_screen_attr = {
-	.name = "CLOCK_SCREEN_THREAD",
-	.priority = osPriorityNormal
-};
-const osThreadAttr_t location_screen_attr = {
-	.name = "LOCATION_SCREEN_THREAD",
-	.priority = osPriorityNormal 
+const osThreadAttr_t gnss_ingest_attr = {
+	.name = "GNSS_INGEST_THREAD",
+	.priority = osPriorityHigh //Above every screen so UART timing never waits on a frame
 };
-const osThreadAttr_t techdata_screen_attr = {
-	.name = "TECHDATA_SCREEN_THREAD",
-	.priority = osPriorityNormal 
+const osThreadAttr_t ui_attr = {
+	.name = "UI_THREAD",
+	.priority = osPriorityNormal
 };
 
 //Mutexes
@@ -85,54 +100,115 @@ const osMutexAttr_t LCD_mutex_attr = {
   0U               // size for control block
 };
 //Event Flags
-osEventFlagsId_t clock_screen_signal;
-osEventFlagsId_t location_screen_signal;
-osEventFlagsId_t techdata_screen_signal;
+osEventFlagsId_t gnss_signal; //Raised by the UART interupt when a full line has been received
 //Message Queues
-osMessageQueueId_t sat_data;
+osMessageQueueId_t ui_queue; //UI_EVENTs for the UI thread, from gnss_ingest and the key scan timer
+
+/*UI*/
+//Events the UI thread reacts to, everything a screen shows changes through one of these
+typedef enum {
+	UI_EVENT_FIX = 1, //gnss_ingest published a new epoch
+	UI_EVENT_INPUT,   //Input_Keys queued key events, the UI thread turns each into a UI_EVENT_KEY
+	UI_EVENT_KEY,     //Key holds its KEY_ index and Input what happened (INPUT_PRESS ...)
+} UI_EVENT_TYPE;
+
+typedef struct {
+	UBYTE Type;
+	UBYTE Key;
+	UBYTE Input;
+} UI_EVENT;
+
+//A screen is a set of callbacks run on the UI thread, none of them may block
+//Update returns true if the event changes what it shows
+//Render records and flushes one frame and returns how many ticks until it must be redrawn anyway
+typedef struct {
+	const char *Name;
+	UBYTE Key; //Key that brings up this screen
+	bool (*Update)(const UI_EVENT *event);
+	UDOUBLE (*Render)(void);
+} UI_SCREEN;
+
+enum {
+	SCREEN_CLOCK,
+	SCREEN_LOCATION,
+	SCREEN_TECHDATA,
+	SCREEN_COUNT,
+};
+
+//Screens draw with palette indexes, the strip renderer expands them to RGB565 on the way to the panel
+//Swapping uiPalette for another one (night mode) recolours every screen without touching them
+enum {
+	UI_BLACK, //Index 0 also shows wherever nothing was recorded
+	UI_WHITE,
+	UI_MINT,
+	UI_GREEN,
+	UI_GOLD,
+	UI_RED,
+};
+const UWORD uiPalette[STRIP_PALETTE_SIZE] = {
+	[UI_BLACK] = BLACK,
+	[UI_WHITE] = WHITE,
+	[UI_MINT]  = MINT,
+	[UI_GREEN] = GREEN,
+	[UI_GOLD]  = GOLD,
+	[UI_RED]   = RED,
+};
 
 /*GLOBAL VARIABLES*/
-UWORD frameBuffer[56448]; //Width*Height*2 The reason we are downscaled is beacuse there is only 256000 bytes of ram
 bool printGNSS = false;
-typedef struct{
-	UBYTE day;
-	UBYTE month;
-	UWORD year;
-	UBYTE hour;
-	UBYTE minute;
-	UBYTE second;
-	float lat;
-	float lon;
-	char lat_area;
-	char lon_area;
-	UBYTE lock_type;
-	UBYTE num_of_sats;
-	float altitude;
-}satellite_data; 
+NMEA_FRAMER gnssFramer;
+GNSS_EPOCH gnssEpoch; //satellite_data is assembled here one epoch (400ms fix interval) at a time
+//Latest coherent fix, written only by gnss_ingest and read lock-free by the screens
+//fixSequence is odd while a write is in progress, 0 until the first fix arrives
+volatile UDOUBLE fixSequence = 0;
+satellite_data fixSnapshot;
+const satellite_data noFix = { .lock_type = '0' };
 
 /*CODE*/
 
-//UART RX is a simple function that flushes the UART buffer to a char pointer
-char* UART_RX() {
-    char* tmp_string = malloc(BUFFSIZE);
-		for(int i = 0; i<BUFFSIZE+1; i++) {
-        char ch = uart_getc(UART_ID);
-        tmp_string[i] = ch;
-    }
-		//Rotate char array to get correct offset
-		int charCount = 105;
-		int offset = 73;
-		for(int i = 0; i<offset; i++)\
+//UART RX drains the interupt filled receive ring through the NMEA framer, returns the next complete sentence or NULL
+const char* UART_RX() {
+		char ch;
+		while(GNSS_UART_Read(&ch)) {
+				const char *sentence = NMEA_Framer_Push(&gnssFramer, ch);
+				if(sentence != NULL) {
+						return sentence;
+				}
+		}
+		return NULL;
+}
+
+//Publish fix replaces the shared snapshot, only the GNSS ingest thread may call it
+void publish_fix(const satellite_data *fix)
+{
+		GNSS_Time_Bind(fix); //Name the PPS edge this epoch belongs to
+		fixSequence++; //odd, readers will retry
+		__DMB();
+		fixSnapshot = *fix;
+		__DMB();
+		fixSequence++; //even again, snapshot is coherent
+		UI_EVENT event = { .Type = UI_EVENT_FIX };
+		osMessageQueuePut(ui_queue, &event, 0, 0);
+}
+
+//Read fix copies the latest snapshot without blocking, retrying if a publish overlapped the copy
+//Returns false (and a zeroed, unlocked fix) if nothing has been published yet
+bool read_fix(satellite_data *fix)
+{
+		UDOUBLE seq;
+		do
 		{
-			char x = tmp_string[charCount-1], i;
-			for (i = charCount-1; i > 0; i--)
+			seq = fixSequence;
+			if(seq == 0)
 			{
-				tmp_string[i] = tmp_string[i-1];
+				*fix = noFix;
+				return false;
 			}
-			tmp_string[0] = x;
-		}
-		tmp_string[BUFFSIZE-2] = '\0';
-    return tmp_string;
+			__DMB();
+			*fix = fixSnapshot;
+			__DMB();
+		} while((seq & 1U) != 0 || seq != fixSequence);
+		return true;
 }
 
 //Converts osStatus signed int to string representation
@@ -164,35 +240,52 @@ void setup_GNSS()
 	DEV_SET_PWM(50);
     
     LCD_1IN3_Init(HORIZONTAL);
+#ifdef LCD_PIO
+    //Define LCD_PIO to drive the panel from a PIO state machine, DC and CS included, instead of SPI and GPIO
+    //Untested on hardware, leave it undefined for a known good build
+    if (!LCD_1IN3_UsePIO()) {
+        printf("No free PIO state machine, LCD stays on SPI\r\n");
+    }
+#endif
     LCD_1IN3_Clear(WHITE);
-    
-    for (int n = 0; n < KEY_NUM; n++) {
-            dev_key_init(n);
+
+    //Core 1 owns the panel from here on, strips are rasterised and sent there while core 0 keeps GNSS time
+    //The DMA interrupt has to be enabled on core 1, so its init runs as a core 1 job too
+    if (!Core1_Start()) {
+        printf("Core 1 start failed\r\n");
     }
-		
+    if (!Core1_Run(lcd_dma_job)) {
+        printf("No free DMA channel, LCD updates are blocking\r\n");
+    }
+    
 	//Interupts are enabled here to prevent false triggering
-	//Must use RPi Pico Hardware interupts to interupt on GPIO changes (RTX reconizes this as an interupt)
-	gpio_set_irq_enabled_with_callback(3, GPIO_IRQ_EDGE_RISE, true, &gpio_callback); //Center joystick
-	gpio_set_irq_enabled(16, GPIO_IRQ_EDGE_RISE, true); //Left joystick
-	gpio_set_irq_enabled(20, GPIO_IRQ_EDGE_RISE, true); //Right joystick
-	gpio_set_irq_enabled(2, GPIO_IRQ_EDGE_RISE, true);  //Up joystick
-	gpio_set_irq_enabled(21, GPIO_IRQ_EDGE_RISE, true); //Button Y
+	//All nine keys are sampled and debounced by a repeating timer, none of them interupt on their own
+	if(!Input_Keys_Init(input_notify))
+	{
+		printf("No free alarm for the key scan timer\n");
+	}
+	
+	//The GPIO interupt is left to PPS alone, its edge is timestamped before anything else runs
+	GNSS_Time_Init();
+	gpio_init(GNSS_PPS_PIN);
+	gpio_set_dir(GNSS_PPS_PIN, GPIO_IN);
+	gpio_set_irq_enabled_with_callback(GNSS_PPS_PIN, GPIO_IRQ_EDGE_RISE, true, &gpio_callback);
 
     //Alert user
-    Paint_NewImage((UBYTE *)frameBuffer, xSize, ySize, 0, BLACK);
-    Paint_SetScale(65);
+    //No frame buffer, frames are display lists rendered a strip at a time straight to the panel
+    Strip_Init(LCD_1IN3_WIDTH, LCD_1IN3_HEIGHT);
+    Strip_SetPalette(uiPalette);
+    Strip_SetOrigin(sqOffset, sqOffset);
 
-    Paint_Clear(WHITE);
-    Paint_DrawString_EN(7, 89, "Initilizing...", &Font16, WHITE, BLACK);
+    Strip_Clear(UI_WHITE);
+    Strip_DrawString_EN(7, 89, "Initilizing...", &Font16, UI_WHITE, UI_BLACK);
 
-	osMutexAcquire(LCD_Mutex, osWaitForever);
-	GLCD_DrawBitmap(sqOffset, sqOffset, xSize, ySize, frameBuffer); //Centered resolution - no upscailing
-	osMutexRelease(LCD_Mutex);
+	flush_frame(); //Centered resolution - no upscailing
 
     //CHECKSUMS ARE PRE-CALCULATED AND INCLUDED WITH INSTRUCTIONS TO SAVE MEMORY
 	#define SET_NMEA_BAUDRATE_115200    "$PMTK251,115200*1F\r\n"                                //Set baudrate of GNSS module to 115200
     #define SET_POS_FIX_400MS           "$PMTK220,400*2A\r\n"                                   //Update position every 400ms
-    #define SET_NMEA_OUTPUT             "$PMTK314,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0*28\r\n" //Set NMEA sentence output frequencies (See page 35 of Quectel_L76_Series_GNSS_Protocol_Specification_V3.3)
+    #define SET_NMEA_OUTPUT             "$PMTK314,0,1,0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0*28\r\n" //Set NMEA sentence output frequencies (See page 35 of Quectel_L76_Series_GNSS_Protocol_Specification_V3.3)
 																				//GLL, RMC, VTG, GGA, GSA, GSV, GRS, GST, ZDA
     #define SET_SYNC_PPS_NMEA_ON        "$PMTK255,1*2D\r\n"                                     //Enable fixed NMEA output times behind PPS function
     
@@ -204,10 +297,12 @@ void setup_GNSS()
     
     printf("Initializing GNSS module, please wait...\n");
     
-    //Init UART Pins and then setup UART with 9600 baud (Default GNSS rate)
+    //Init UART Pins and then setup UART with 9600 baud (Default GNSS rate), received bytes are buffered by interupt from here on
     gpio_set_function(UART_TX_PIN, GPIO_FUNC_UART);
     gpio_set_function(UART_RX_PIN, GPIO_FUNC_UART);
-    UWORD baudRate = uart_init(UART_ID, SETUP_BAUD_RATE);
+    NMEA_Framer_Init(&gnssFramer);
+    GNSS_Epoch_Init(&gnssEpoch, GNSS_EPOCH_SENTENCES, publish_fix);
+    UWORD baudRate = GNSS_UART_Init(UART_ID, SETUP_BAUD_RATE, gnss_signal, GNSS_LINE_FLAG);
 	printf("Initilized UART at: %i baud\n\n", baudRate);
 		
     //Init force and standyby pins
@@ -248,389 +343,376 @@ void setup_GNSS()
 	printf("Sent: %s\n", SET_SYNC_PPS_NMEA_ON);
     osDelay(500);
     
-    Paint_Clear(WHITE);
-    Paint_DrawString_EN(23, 89, "Initialized!", &Font16, WHITE, BLACK);
+    Strip_Clear(UI_WHITE);
+    Strip_DrawString_EN(23, 89, "Initialized!", &Font16, UI_WHITE, UI_BLACK);
 
-	osMutexAcquire(LCD_Mutex, osWaitForever);
-	GLCD_DrawBitmap(sqOffset, sqOffset, xSize, ySize, frameBuffer); //Centered resolution - no upscailing
-	osMutexRelease(LCD_Mutex);
+	flush_frame(); //Centered resolution - no upscailing
 
     osDelay(500);
 		
-	LCD_1IN3_Clear(BLACK);  
 	
 	//All threads created here to ensure the setup thread completes without interuption
-	clock_screen_TID = osThreadNew(clock_screen, NULL, &clock_screen_attr);
-	location_screen_TID = osThreadNew(location_screen, NULL, &location_screen_attr);
-	techdata_screen_TID = osThreadNew(techdata_screen, NULL, &techdata_screen_attr);
-	osThreadSuspend(location_screen_TID);
-	osThreadSuspend(techdata_screen_TID);
+	gnss_ingest_TID = osThreadNew(gnss_ingest, NULL, &gnss_ingest_attr);
+	ui_TID = osThreadNew(ui_thread, NULL, &ui_attr);
 	
 	osThreadTerminate	(setup_TID);	//free up the mem, setup thread only needs to be ran once
 }
 
-//L76X_Update receives the UART buffer and proceccess the raw strings into useable time, location, and tracking information
+//Sentence decoders indexed by type, any talker (GP/GL/GA/GB/GN) reaches the same decoder
+//Types without a decoder are still framed and counted, then ignored
+const NMEA_DECODER gnssDecoders[NMEA_SENTENCE_COUNT] = {
+		[NMEA_SENTENCE_RMC] = GNSS_Epoch_DecodeRMC,
+		[NMEA_SENTENCE_GGA] = GNSS_Epoch_DecodeGGA,
+		[NMEA_SENTENCE_GSA] = GNSS_Epoch_DecodeGSA,
+		[NMEA_SENTENCE_ZDA] = GNSS_Epoch_DecodeZDA,
+};
+
+//L76X_Update frames whatever the UART has received and proceccess complete sentences into useable time, location, and tracking information
+//It never waits on the UART, sentences that are still arriving are finished on the next call
+//Each sentence is merged into the epoch with the same UTC stamp, the assembler publishes the epoch once it is complete
 void L76X_Update()
 {
-    char* tmp_string = UART_RX();
+		bool fixUpdated = false;
 	
-		if(printGNSS)
-		{
-			printf("%s",tmp_string);
-			printf("\n------------------------\n");
-		}
-		
-		satellite_data data;
-	
-    char *pch = strtok (tmp_string, "\r\n");
-    while (pch != NULL)
+    const char *pch;
+    while ((pch = UART_RX()) != NULL)
     {
-        //It is inherent that you must check for a specifc NMEA packet in the order they are recieved
-        //Data is accessed from a static position to avoid slowing in for loops
-        if(pch[0] == '$' && pch[1] == 'G' && pch[2] == 'N' && pch[3] == 'Z' && pch[4] == 'D' && pch[5] == 'A')
-        {
-            //$GNZDA (ZDA (Zone Distribution Area) interval - Time and date)
-						char *raw_day_str = (char*)malloc(3*sizeof(char));
-            raw_day_str[0] = pch[18];
-            raw_day_str[1] = pch[19];
-            raw_day_str[2] = '\0';
-            data.day = atoi(raw_day_str);
-            
-						char *raw_month_str = (char*)malloc(3*sizeof(char));
-            raw_month_str[0] = pch[21];
-            raw_month_str[1] = pch[22];
-            raw_month_str[2] = '\0';
-            data.month = atoi(raw_month_str);
-            
-						char *raw_year_str = (char*)malloc(5*sizeof(char));
-            raw_year_str[0] = pch[24];
-            raw_year_str[1] = pch[25];
-            raw_year_str[2] = pch[26];
-            raw_year_str[3] = pch[27];
-            raw_year_str[4] = '\0';
-            data.year = atoi(raw_year_str);
-					
-						free(raw_day_str);
-						free(raw_month_str);
-						free(raw_year_str);
-        }
-        else if(pch[0] == '$' && pch[1] == 'G' && pch[2] == 'N' && pch[3] == 'G' && pch[4] == 'G' && pch[5] == 'A')
-        {
-            //$GNGGA (GGA, Global Positioning System Fix Data)
-						char *raw_time_str = (char*)malloc(7*sizeof(char));
-            raw_time_str[0] = pch[7];
-            raw_time_str[1] = pch[8];
-            raw_time_str[2] = pch[9];
-            raw_time_str[3] = pch[10];
-            raw_time_str[4] = pch[11];
-            raw_time_str[5] = pch[12];
-            raw_time_str[6] = '\0';
-            
-            UDOUBLE raw_time = atoi(raw_time_str);
-						//printf("Raw Time: %s\n", raw_time_str);
-						//printf("Time: %d\n", raw_time);
-            
-            data.hour = (raw_time/10000); 		//First two digits
-            data.minute = raw_time/100%100;	//Next two digits
-            data.second = raw_time%100;			//Last two digits
-            
-						char *raw_lat_string = (char*)malloc(10*sizeof(char));
-            raw_lat_string[0] = pch[18];
-            raw_lat_string[1] = pch[19];
-            raw_lat_string[2] = pch[20];
-            raw_lat_string[3] = pch[21];
-            raw_lat_string[4] = '.';
-            raw_lat_string[5] = pch[23];
-            raw_lat_string[6] = pch[24];
-            raw_lat_string[9] = '\0';
-            data.lat = atof(raw_lat_string);
-            data.lat_area = pch[28];
-            
-						char *raw_lon_string = (char*)malloc(11*sizeof(char));
-            raw_lon_string[0] = pch[30];
-            raw_lon_string[1] = pch[31];
-            raw_lon_string[2] = pch[32];
-            raw_lon_string[3] = pch[33];
-            raw_lon_string[4] = pch[34];
-            raw_lon_string[5] = '.';
-            raw_lon_string[6] = pch[36];
-            raw_lon_string[7] = pch[37];
-            raw_lon_string[10] = '\0';
-            data.lon = atof(raw_lon_string);
-            data.lon_area = pch[38]; 
-						
-						free(raw_lat_string);
-						free(raw_lon_string);
-						
-            data.lock_type = (UBYTE)(pch[40]);
-						char *raw_alt_string = (char*)malloc(6*sizeof(char));
-            if(pch[43] == ',')
-            {
-								data.num_of_sats = pch[42] - '0'; //conversion from char rep of int to int
-								raw_alt_string[0] = pch[49];
-								raw_alt_string[1] = pch[50];
-								raw_alt_string[2] = pch[51];
-								raw_alt_string[3] = '.';
-								raw_alt_string[4] = pch[53];
-								raw_alt_string[5] = '\0';
-            }
-            else
-            {
-                char raw_sat_string[3];
-                raw_sat_string[0] = pch[42];
-                raw_sat_string[1] = pch[43];
-                raw_sat_string[2] = '\0';
-                data.num_of_sats = atoi(raw_sat_string);
-
-								raw_alt_string[0] = pch[50];
-								raw_alt_string[1] = pch[51];
-								raw_alt_string[2] = pch[52];
-								raw_alt_string[3] = '.';
-								raw_alt_string[4] = pch[54];
-								raw_alt_string[5] = '\0';
-            }
-						data.altitude = atof(raw_alt_string);
-						free(raw_alt_string);
-        }
-
-        pch = strtok (NULL, "\r\n");
+				if(printGNSS)
+				{
+					printf("%s\n",pch);
+				}
+				if(NMEA_Dispatch(pch, gnssDecoders, &gnssEpoch) == NMEA_SENTENCE_GGA)
+				{
+					fixUpdated = true;
+				}
     }
-		osStatus_t qStatus = osMessageQueuePut(sat_data, &data, 0U, 0U); 
-		//printf("Q Put status: %s\n",getStatusName(qStatus));
-    memset(tmp_string,0,strlen(tmp_string));
-    free(tmp_string);
+		if(fixUpdated && printGNSS)
+		{
+			//Link quality, only checksum-valid sentences ever reach the decoder
+			const NMEA_COUNTERS *gga = NMEA_GetCounters(&gnssFramer, NMEA_SENTENCE_GGA);
+			const NMEA_COUNTERS *zda = NMEA_GetCounters(&gnssFramer, NMEA_SENTENCE_ZDA);
+			printf("GGA ok:%u bad:%u trunc:%u ovr:%u | ZDA ok:%u bad:%u trunc:%u ovr:%u | RX dropped:%u\n",
+				gga->Accepted, gga->BadChecksum, gga->Truncated, gga->Overrun,
+				zda->Accepted, zda->BadChecksum, zda->Truncated, zda->Overrun,
+				GNSS_UART_GetDropped());
+		}
 }
 
-
-void techdata_screen()
-{		
+//GNSS ingest is the only reader of the UART ring, it sleeps until the UART interupt reports a complete line
+void gnss_ingest()
+{
 		while(1)
-    {
-			/*  
-					Font24 - 17pixels/char
-					Font20 - 14pixels/char
-					Font16 - 11pixels/char
-					To calculate offset:
-							(xSize-(#numOfChars * fontPixPerChar))/2
-			*/
-			satellite_data data;
-			osStatus_t qStatus = osMessageQueueGet(sat_data, &data, 0U, 0U);
-			//printf("Q Get status: %s\n",getStatusName(qStatus));
-			Paint_Clear(BLACK); //reset frame buffer
-			Paint_DrawString_EN(7, 1, "TECH DATA", &Font24, BLACK, WHITE);
+		{
+			osEventFlagsWait(gnss_signal, GNSS_LINE_FLAG, osFlagsWaitAny, osWaitForever); //Clears the flag, a line finishing while we drain raises it again
 			L76X_Update();
-			
-			Paint_DrawString_EN(7, 40, "Num of Sats", &Font20, BLACK, MINT);
-			char *numOfSatsString = (char*)malloc(3*sizeof(char));
-			sprintf(numOfSatsString, "%02d", data.num_of_sats);  
-			Paint_DrawString_EN(73, 65, numOfSatsString, &Font16, BLACK, WHITE);
-			
-			Paint_DrawString_EN(28, 90, "Altitude", &Font20, BLACK, MINT);
-			char *altString = (char*)malloc(8*sizeof(char));
-			sprintf(altString, "%05.2f M", data.altitude);
-			Paint_DrawString_EN(40, 120, altString, &Font16, BLACK, WHITE);
-			
-			switch(data.lock_type){
-					case '1':
-							Paint_DrawString_EN(29, 150, "Lock: ", &Font16, BLACK, WHITE);
-							Paint_DrawString_EN(88, 150, "GNSS", &Font16, BLACK, GREEN );
-							break;
-					case '2':
-							Paint_DrawString_EN(29,  150, "Lock: ", &Font16, BLACK, WHITE);
-							Paint_DrawString_EN(88, 150, "DGPS", &Font16, BLACK, GREEN );
-							break;
-					case '6':
-							Paint_DrawString_EN(1, 150, "Lock: ", &Font16, BLACK, WHITE);
-							Paint_DrawString_EN(62, 150, "Estimated", &Font16, BLACK, GOLD);
-							break;
-					default:
-							Paint_DrawString_EN(29,  150, "Lock: ", &Font16, BLACK, WHITE); 
-							Paint_DrawString_EN(88, 150, "None", &Font16, BLACK, RED);
-							break;
-			}
-			osMutexAcquire(LCD_Mutex, osWaitForever);
-			GLCD_DrawBitmap(sqOffset, sqOffset, xSize, ySize, frameBuffer); //Centered resolution - no upscailing
-			osMutexRelease(LCD_Mutex);
-			osDelay(200);
-			if(osEventFlagsGet(clock_screen_signal) != 0)
-			{
-				osEventFlagsClear(clock_screen_signal, 0x00000001U);
-				osStatus_t resume = osThreadResume(clock_screen_TID);
-				printf("Resumed %s thread. Result: %s\n", osThreadGetName(clock_screen_TID), getStatusName(resume));
-				osStatus_t suspend = osThreadSuspend(techdata_screen_TID);
-			}
-			else if(osEventFlagsGet(location_screen_signal) != 0)
-			{
-				osEventFlagsClear(location_screen_signal, 0x00000001U);
-				osStatus_t resume = osThreadResume(location_screen_TID);
-				printf("Resumed %s thread. Result: %s\n", osThreadGetName(location_screen_TID), getStatusName(resume));
-				osStatus_t suspend = osThreadSuspend(techdata_screen_TID);
-			}
 		}
 }
 
-void location_screen()
-{		
-		while(1)
-    {
-			/*  
-					Font24 - 17pixels/char
-					Font20 - 14pixels/char
-					Font16 - 11pixels/char
-					To calculate offset:
-							(xSize-(#numOfChars * fontPixPerChar))/2
-			*/
-			satellite_data data;
-			osStatus_t qStatus = osMessageQueueGet(sat_data, &data, 0U, 0U);
-			//printf("Q Get status: %s\n",getStatusName(qStatus));
-			Paint_Clear(BLACK); //reset frame buffer
-			Paint_DrawString_EN(16, 1, "LOCATION", &Font24, BLACK, WHITE);
-			L76X_Update();
-			
-			Paint_DrawString_EN(28, 50, "Latitude", &Font20, BLACK, MINT);
-			char *latString = (char*)malloc(10*sizeof(char));
-			sprintf(latString, "%4.2f %c", data.lat, data.lat_area);  //Format: ffff.ff c (4 digits before decimal, two after the decimal)
-			Paint_DrawString_EN(35, 80, latString, &Font16, BLACK, WHITE);
-			Paint_DrawString_EN(21, 110, "Longitude", &Font20, BLACK, MINT);
-			char *lonString = (char*)malloc(11*sizeof(char));
-			sprintf(lonString, "%08.2f %c", data.lon, data.lon_area); //Format: fffff.ff c (seven digits in total, pad zeros, two after the decimal)
-			Paint_DrawString_EN(29, 140, lonString, &Font16, BLACK, WHITE);
-			
-			osMutexAcquire(LCD_Mutex, osWaitForever);
-			GLCD_DrawBitmap(sqOffset, sqOffset, xSize, ySize, frameBuffer); //Centered resolution - no upscailing
-			osMutexRelease(LCD_Mutex);
-			osDelay(200);
-			
-			free(latString);
-			free(lonString);
-			
-			if(osEventFlagsGet(clock_screen_signal) != 0)
-			{
-				osEventFlagsClear(clock_screen_signal, 0x00000001U);
-				osStatus_t resume = osThreadResume(clock_screen_TID);
-				printf("Resumed %s thread. Result: %s\n", osThreadGetName(clock_screen_TID), getStatusName(resume));
-				osStatus_t suspend = osThreadSuspend(location_screen_TID);
-			}
-			else if(osEventFlagsGet(techdata_screen_signal) != 0)
-			{
-				osEventFlagsClear(techdata_screen_signal, 0x00000001U);
-				osStatus_t resume = osThreadResume(techdata_screen_TID);
-				printf("Resumed %s thread. Result: %s\n", osThreadGetName(techdata_screen_TID), getStatusName(resume));
-				osStatus_t suspend = osThreadSuspend(location_screen_TID);
-			}
-		}
+
+//Flush frame renders and sends only the parts of the recorded frame that differ from the last one
+//The work happens on core 1 and this returns at once, so the next frame is recorded while this one is sent
+//Only the previous flush is waited for, its display list is the one the next frame is compared against
+void flush_frame()
+{
+		osMutexAcquire(LCD_Mutex, osWaitForever);
+		Core1_Wait();
+		Strip_Submit();
+		Core1_Post(flush_job);
+		osMutexRelease(LCD_Mutex);
 }
 
-void clock_screen()
+//Core 1 jobs, these must not call RTX
+UDOUBLE lcd_dma_job()
 {
-    while(1)
-    {
-			/*  
-					Font24 - 17pixels/char
-					Font20 - 14pixels/char
-					Font16 - 11pixels/char
-					To calculate offset:
-							(xSize-(#numOfChars * fontPixPerChar))/2
-			*/
-			satellite_data data;
-			osStatus_t qStatus = osMessageQueueGet(sat_data, &data, 0U, 0U);
-			//printf("Q Get status: %s\n",getStatusName(qStatus));
-			Paint_Clear(BLACK); //reset frame buffer
-			Paint_DrawString_EN(7, 1, "GPS CLOCK", &Font24, BLACK, WHITE);
-			L76X_Update();
+		return LCD_1IN3_DMA_Init();
+}
 
-			char timeOfDay = 'A';
-			//EST Adjustment
-			if(data.hour - 4 <= 0) //rollover
-			{
-				switch(data.hour){
-					case 0: 
-						data.hour = (23-3);
+UDOUBLE flush_job()
+{
+		UDOUBLE bytes = Strip_Flush(LCD_1IN3_DisplayRegionAsync);
+		LCD_1IN3_WaitIdle(); //Spins on core 1, Core1_Wait then means the frame is on the panel
+		return bytes;
+}
+
+//Draw centered places text in the middle of the screen, text wider than the screen starts at the left edge
+void draw_centered(UWORD y, const char *text, sFONT *font, UWORD background, UWORD foreground)
+{
+		UWORD width = strlen(text) * font->Width;
+		Strip_DrawString_EN((width < xSize) ? (xSize - width) / 2 : 0, y, text, font, background, foreground);
+}
+
+//Draw lock shows the GGA fix quality
+void draw_lock(UBYTE lock_type)
+{
+		switch(lock_type){
+				case '1':
+						Strip_DrawString_EN(29, 150, "Lock: ", &Font16, UI_BLACK, UI_WHITE);
+						Strip_DrawString_EN(88, 150, "GNSS", &Font16, UI_BLACK, UI_GREEN );
 						break;
-					case 1: 
-						data.hour = (23-2);
+				case '2':
+						Strip_DrawString_EN(29,  150, "Lock: ", &Font16, UI_BLACK, UI_WHITE);
+						Strip_DrawString_EN(88, 150, "DGPS", &Font16, UI_BLACK, UI_GREEN );
 						break;
-					case 2: data.hour = (23-1);
+				case '6':
+						Strip_DrawString_EN(1, 150, "Lock: ", &Font16, UI_BLACK, UI_WHITE);
+						Strip_DrawString_EN(62, 150, "Estimated", &Font16, UI_BLACK, UI_GOLD);
 						break;
-					case 3: data.hour = (23);
+				default:
+						Strip_DrawString_EN(29,  150, "Lock: ", &Font16, UI_BLACK, UI_WHITE); 
+						Strip_DrawString_EN(88, 150, "None", &Font16, UI_BLACK, UI_RED);
 						break;
-				}
-				data.day = data.day - 1; //UTC adjustment
+		}
+}
+
+//Tech data screen, satellites in use and altitude
+UDOUBLE techdata_render()
+{
+		/*  
+				Font24 - 17pixels/char
+				Font20 - 14pixels/char
+				Font16 - 11pixels/char
+				To calculate offset:
+						(xSize-(#numOfChars * fontPixPerChar))/2
+		*/
+		satellite_data data;
+		read_fix(&data);
+		//The whole frame is recorded every time, only what differs from the last one is sent
+		Strip_Clear(UI_BLACK);
+		Strip_DrawString_EN(7, 1, "TECH DATA", &Font24, UI_BLACK, UI_WHITE);
+		Strip_DrawString_EN(7, 40, "Num of Sats", &Font20, UI_BLACK, UI_MINT);
+		Strip_DrawString_EN(28, 90, "Altitude", &Font20, UI_BLACK, UI_MINT);
+		
+		char numOfSatsString[4];
+		Format_Uint(numOfSatsString, data.num_of_sats, 2, '0');
+		Strip_DrawString_EN(73, 65, numOfSatsString, &Font16, UI_BLACK, UI_WHITE);
+		
+		char altString[16];
+		Format_String(Format_Fixed(altString, data.altitude, 2, 5, '0'), " M"); //Format: %05.2f M (metres, altitude is in centimetres)
+		Strip_DrawString_EN(40, 120, altString, &Font16, UI_BLACK, UI_WHITE);
+		
+		draw_lock(data.lock_type);
+		flush_frame();
+		return osWaitForever; //Satellites and altitude only change with a new epoch
+}
+
+//Location screen, latitude and longitude in decimal degrees
+UDOUBLE location_render()
+{
+		/*  
+				Font24 - 17pixels/char
+				Font20 - 14pixels/char
+				Font16 - 11pixels/char
+				To calculate offset:
+						(xSize-(#numOfChars * fontPixPerChar))/2
+		*/
+		satellite_data data;
+		read_fix(&data);
+		//The whole frame is recorded every time, only what differs from the last one is sent
+		Strip_Clear(UI_BLACK);
+		Strip_DrawString_EN(16, 1, "LOCATION", &Font24, UI_BLACK, UI_WHITE);
+		Strip_DrawString_EN(28, 50, "Latitude", &Font20, UI_BLACK, UI_MINT);
+		Strip_DrawString_EN(21, 110, "Longitude", &Font20, UI_BLACK, UI_MINT);
+		
+		char latString[12];
+		UDOUBLE latAbs = (data.lat < 0) ? -data.lat : data.lat;
+		Format_Char(Format_Char(Format_Fixed(latString, latAbs/100, 4, 7, ' '), ' '), data.lat_area); //Format: dd.dddd c (decimal degrees, four after the decimal)
+		Strip_DrawString_EN(35, 80, latString, &Font16, UI_BLACK, UI_WHITE);
+		char lonString[12];
+		UDOUBLE lonAbs = (data.lon < 0) ? -data.lon : data.lon;
+		Format_Char(Format_Char(Format_Fixed(lonString, lonAbs/100, 4, 8, '0'), ' '), data.lon_area); //Format: ddd.dddd c (decimal degrees, pad zeros, four after the decimal)
+		Strip_DrawString_EN(29, 140, lonString, &Font16, UI_BLACK, UI_WHITE);
+		
+		flush_frame();
+		return osWaitForever; //Position only changes with a new epoch
+}
+
+//Clock screen, local time and date from the disciplined clock with its error bound
+UDOUBLE clock_render()
+{
+		/*  
+				Font24 - 17pixels/char
+				Font20 - 14pixels/char
+				Font16 - 11pixels/char
+				To calculate offset:
+						(xSize-(#numOfChars * fontPixPerChar))/2
+		*/
+		satellite_data data;
+		GNSS_UTC utc;
+		read_fix(&data);
+		//Show the disciplined clock rather than the last epoch, which is already behind by its transmit time
+		if(GNSS_Time_Now(&utc) != GNSS_TIME_NONE)
+		{
+			data.year = utc.Year;
+			data.month = utc.Month;
+			data.day = utc.Day;
+			data.hour = utc.Hour;
+			data.minute = utc.Minute;
+			data.second = utc.Second;
+		}
+		else
+		{
+			utc.Micros = 0;
+			utc.Source = GNSS_TIME_NONE;
+		}
+		//The whole frame is recorded every time, only what differs from the last one is sent
+		Strip_Clear(UI_BLACK);
+		Strip_DrawString_EN(7, 1, "GPS CLOCK", &Font24, UI_BLACK, UI_WHITE);
+
+		char timeOfDay = 'A';
+		//EST Adjustment
+		if(data.hour - 4 <= 0) //rollover
+		{
+			switch(data.hour){
+				case 0: 
+					data.hour = (23-3);
+					break;
+				case 1: 
+					data.hour = (23-2);
+					break;
+				case 2: data.hour = (23-1);
+					break;
+				case 3: data.hour = (23);
+					break;
 			}
-			else
+			data.day = data.day - 1; //UTC adjustment
+		}
+		else
+		{
+			data.hour = data.hour - 4;
+		}
+		UBYTE hourConv = data.hour;
+		//24 hour adjustment
+		if(hourConv > 12)
+		{
+				hourConv = hourConv - 12; //24 hour adjusted
+				timeOfDay = 'P';
+		}
+		else if(hourConv == 12)
+		{
+				timeOfDay = 'P';
+		}
+		char timeString[12];
+		Format_Char(Format_Char(Format_Time(timeString, hourConv, data.minute, data.second, 1), timeOfDay), 'M');
+		Strip_DrawString_EN((hourConv < 10) ? 21 : 14, 60, timeString, &Font20, UI_BLACK, UI_WHITE); //Centered, one character narrower with a single digit hour
+
+		char dateString[12];
+		Format_Date(dateString, data.month, data.day, data.year);
+		Strip_DrawString_EN(14, 104, dateString, &Font20, UI_BLACK, UI_WHITE);
+
+		//Error bound of the displayed time, grows while holding over without lock
+		if(utc.Source != GNSS_TIME_NONE)
+		{
+			char errorString[20];
+			const char *mode = (utc.Source == GNSS_TIME_PPS) ? "PPS" : (utc.Source == GNSS_TIME_HOLDOVER) ? "HOLD" : "NMEA";
+			char *bound = Format_String(Format_String(errorString, mode), " +/-");
+			if(utc.ErrorUs < 1000)
 			{
-				data.hour = data.hour - 4;
+				Format_String(Format_Uint(bound, utc.ErrorUs, 0, '0'), "us");
 			}
-			UBYTE hourConv = data.hour;
-			//24 hour adjustment
-			if(hourConv > 12)
+			else if(utc.ErrorUs < 1000000)
 			{
-					hourConv = hourConv - 12; //24 hour adjusted
-					timeOfDay = 'P';
+				Format_String(Format_Fixed(bound, utc.ErrorUs/100, 1, 0, '0'), "ms"); //Tenths of a millisecond
 			}
-			else if(hourConv == 12)
+			else
 			{
-					timeOfDay = 'P';
+				Format_String(Format_Uint(bound, utc.ErrorUs/1000000, 0, '0'), "s");
 			}
-			char *timeString = (char*)malloc(12*sizeof(char));
-			sprintf(timeString, "%d:%02d:%02d%cM", hourConv, data.minute, data.second, timeOfDay);
-			//Adjust for single digit hour
-			if(((UBYTE)(hourConv/10)) == 0)
+			draw_centered(131, errorString, &Font12, UI_BLACK, (utc.Source == GNSS_TIME_PPS) ? UI_GREEN : UI_GOLD);
+		}
+
+		draw_lock(data.lock_type);
+		flush_frame();
+		//Besides new epochs, redraw on the disciplined clock's next second boundary
+		return (utc.Source == GNSS_TIME_NONE) ? osWaitForever : (1000000 - utc.Micros + 999) / 1000;
+}
+
+//Every screen shows the latest fix, so each new epoch may change it
+bool redraw_on_fix(const UI_EVENT *event)
+{
+		return event->Type == UI_EVENT_FIX;
+}
+
+//Screen registry, the UI thread starts on the first entry
+const UI_SCREEN uiScreens[SCREEN_COUNT] = {
+		[SCREEN_CLOCK]    = { "CLOCK",    KEY_HOME,  redraw_on_fix, clock_render },
+		[SCREEN_LOCATION] = { "LOCATION", KEY_LEFT,  redraw_on_fix, location_render },
+		[SCREEN_TECHDATA] = { "TECHDATA", KEY_RIGHT, redraw_on_fix, techdata_render },
+};
+
+//UI handle applies one event, switching screens on their key, returns true if the frame must be redrawn
+bool ui_handle(const UI_EVENT *event, UBYTE *active)
+{
+		if(event->Type == UI_EVENT_INPUT)
+		{
+			//Drain the key ring, every key event goes through here like any other
+			bool redraw = false;
+			INPUT_EVENT input;
+			while(Input_Keys_Read(&input))
 			{
-				Paint_DrawString_EN(21, 60, timeString, &Font20, BLACK, WHITE);
+				UI_EVENT key = { .Type = UI_EVENT_KEY, .Key = input.Key, .Input = input.Type };
+				redraw |= ui_handle(&key, active);
 			}
-			else
+			return redraw;
+		}
+		if(event->Type == UI_EVENT_KEY && event->Key == KEY_Y && event->Input == INPUT_PRESS)
+		{
+			printGNSS = !printGNSS; //Echo NMEA sentences to stdout
+			return false;
+		}
+		if(event->Type == UI_EVENT_KEY && event->Input == INPUT_PRESS)
+		{
+			for(UBYTE i = 0; i < SCREEN_COUNT; i++)
 			{
-				Paint_DrawString_EN(14, 60, timeString, &Font20, BLACK, WHITE);
+				if(uiScreens[i].Key == event->Key && i != *active)
+				{
+					*active = i;
+					printf("Showing %s screen\n", uiScreens[i].Name);
+					return true;
+				}
 			}
+		}
+		return uiScreens[*active].Update(event);
+}
 
+//UI thread owns the panel, it sleeps on ui_queue and redraws the active screen only when an event or its timeout calls for it
+//A frame is drawn at most once per panel refresh, events arriving before then are merged into it
+void ui_thread()
+{
+		UBYTE active = SCREEN_CLOCK;
+		bool redraw = true;
+		UDOUBLE lastFrame = 0, wait = osWaitForever;
+		UI_EVENT event;
 
-			memset(timeString,0,strlen(timeString));
-			char *dateString = (char*)malloc(9*sizeof(char));
-			sprintf(dateString, "%02d/%02d/%02d", data.month, data.day, data.year);
-			Paint_DrawString_EN(14, 104, dateString, &Font20, BLACK, WHITE);
-			memset(dateString,0,strlen(dateString));
-
-			switch(data.lock_type){
-					case '1':
-							Paint_DrawString_EN(29, 150, "Lock: ", &Font16, BLACK, WHITE);
-							Paint_DrawString_EN(88, 150, "GNSS", &Font16, BLACK, GREEN );
-							break;
-					case '2':
-							Paint_DrawString_EN(29,  150, "Lock: ", &Font16, BLACK, WHITE);
-							Paint_DrawString_EN(88, 150, "DGPS", &Font16, BLACK, GREEN );
-							break;
-					case '6':
-							Paint_DrawString_EN(1, 150, "Lock: ", &Font16, BLACK, WHITE);
-							Paint_DrawString_EN(62, 150, "Estimated", &Font16, BLACK, GOLD);
-							break;
-					default:
-							Paint_DrawString_EN(29,  150, "Lock: ", &Font16, BLACK, WHITE); 
-							Paint_DrawString_EN(88, 150, "None", &Font16, BLACK, RED);
-							break;
+		while(1)
+		{
+			if(redraw)
+			{
+				UDOUBLE sinceFrame = osKernelGetTickCount() - lastFrame;
+				if(sinceFrame < RENDER_FRAME_MS)
+				{
+					osDelay(RENDER_FRAME_MS - sinceFrame);
+				}
+				while(osMessageQueueGet(ui_queue, &event, NULL, 0) == osOK) //The frame about to be drawn covers these too
+				{
+					ui_handle(&event, &active);
+				}
+				lastFrame = osKernelGetTickCount();
+				wait = uiScreens[active].Render();
+				redraw = false;
 			}
-			osMutexAcquire(LCD_Mutex, osWaitForever);
-			GLCD_DrawBitmap(sqOffset, sqOffset, xSize, ySize, frameBuffer); //Centered resolution - no upscailing
-			osMutexRelease(LCD_Mutex);
-			osDelay(200);
-			
-			free(timeString);
-			free(dateString);
-			
-			if(osEventFlagsGet(location_screen_signal) != 0)
+
+			UDOUBLE timeout = osWaitForever;
+			if(wait != osWaitForever)
 			{
-				osEventFlagsClear(location_screen_signal, 0x00000001U);
-				osStatus_t resume = osThreadResume(location_screen_TID);
-				printf("Resumed %s thread. Result: %s\n", osThreadGetName(location_screen_TID), getStatusName(resume));
-				osStatus_t suspend = osThreadSuspend(clock_screen_TID);
+				UDOUBLE elapsed = osKernelGetTickCount() - lastFrame;
+				timeout = (elapsed < wait) ? wait - elapsed : 0;
 			}
-			else if(osEventFlagsGet(techdata_screen_signal) != 0)
+			if(osMessageQueueGet(ui_queue, &event, NULL, timeout) != osOK)
 			{
-				osEventFlagsClear(techdata_screen_signal, 0x00000001U);
-				osStatus_t resume = osThreadResume(techdata_screen_TID);
-				printf("Resumed %s thread. Result: %s\n", osThreadGetName(techdata_screen_TID), getStatusName(resume));
-				osStatus_t suspend = osThreadSuspend(clock_screen_TID);
+				redraw = true; //The screen's own deadline passed
+				continue;
 			}
+			redraw = ui_handle(&event, &active);
 		}
 }
 
@@ -657,40 +739,21 @@ void system_info()
 	
 }
 
-//Interupt for GPIO, flags are set here to switch threads
+//Interupt for GPIO, only the GNSS 1PPS edge, it must never wait
 void gpio_callback(uint gpio, uint32_t events) {
-		if(gpio==3) //joystick center
+		if(gpio==GNSS_PPS_PIN)
 		{
-			//trigger primary screen
-			osEventFlagsSet(clock_screen_signal, 0x00000001U);
-			osDelay(500); //debounce
-		}
-    if(gpio==16) //joystick left
-		{
-			//trigger location screen
-			osEventFlagsSet(location_screen_signal, 0x00000001U);
-			osDelay(500); //debounce
-		}
-		if(gpio==20) //joystick right
-		{
-			//trigger technical data screen
-			osEventFlagsSet(techdata_screen_signal, 0x00000001U);
-			osDelay(500); //debounce
-		}
-		if(gpio==21) //Button Y
-		{
-			if(printGNSS == false)
-			{
-				printGNSS = true;
-			}
-			else if(printGNSS == true)
-			{
-				printGNSS = false;
-			}
-			osDelay(500); //debounce
+			GNSS_Time_PPS();
 		}
 }
 
+//Input notify runs in the key scan interupt, it only wakes the UI thread which reads the keys itself
+void input_notify()
+{
+		UI_EVENT event = { .Type = UI_EVENT_INPUT };
+		osMessageQueuePut(ui_queue, &event, 0, 0);
+}
+
 int main(void) 
 
 {
@@ -703,11 +766,9 @@ int main(void)
 		//Hardware interupts are created in setup_GNSS to ensure no false triggering
 		osKernelInitialize(); 
 		LCD_Mutex = osMutexNew(&LCD_mutex_attr);
-		clock_screen_signal = osEventFlagsNew(NULL);
-		location_screen_signal = osEventFlagsNew(NULL);
-		techdata_screen_signal = osEventFlagsNew(NULL);
+		gnss_signal = osEventFlagsNew(NULL);
+		ui_queue = osMessageQueueNew(UI_QUEUE_LEN, sizeof(UI_EVENT), NULL);
 		setup_TID = osThreadNew(setup_GNSS, NULL, &setup_attr);
-		sat_data = osMessageQueueNew(2, sizeof(satellite_data), NULL);
 		osKernelStart();   
 
     //Catch all, should never reach
@@ -0,0 +1,45 @@
+@echo off
+rem Reports code from this project that references the C heap.
+rem armlink lists section cross references in the map (Options, Listing: Linker Listing
+rem and Cross Reference, set in every target of template.uvprojx) as
+rem     main.o(.text.clock_render) refers to malloc.o(.text) for malloc
+rem     main.o(.text.clock_render) refers (Weak) to malloc.o(.text) for malloc
+rem Only objects built from main.c and bsp are checked. The C library keeps the
+rem allocations of its own stdio (stream buffers behind printf) and the pico-sdk
+rem keeps alarm_pool_create, neither is called from this project.
+rem
+rem main.o always refers to osKernelStart. If that line is not found the map has no
+rem cross references or their format is not the one above, and the check fails
+rem instead of passing without having looked.
+rem
+rem Not yet run against a real armlink map, so Stop on Exit Code is off and a hit only
+rem shows in the build output. Before turning it on, build once as is (no hits) and
+rem once with a malloc call added to main.c (one hit for main.o).
+set MAP=.\Listings\template.map
+set FOUND=0
+
+if not exist %MAP% (
+    echo check_no_heap: %MAP% not found, enable the linker listing with cross references
+    exit /b 1
+)
+
+findstr /R /C:"^ *main\.o(.*) refers.* to .* for osKernelStart" %MAP% >nul
+if errorlevel 1 (
+    echo check_no_heap: no cross references for main.o in %MAP%, format not recognised
+    exit /b 1
+)
+
+call :check main
+for /R ..\..\bsp %%s in (*.c) do call :check %%~ns
+
+if %FOUND% neq 0 (
+    echo check_no_heap: malloc, calloc, realloc or free referenced from application code
+    exit /b 1
+)
+exit /b 0
+
+:check
+rem No end anchor, findstr only matches $ before CR LF and the symbol may be followed by blanks
+findstr /R /I /C:"^ *%1\.o(.*) refers.* to .* for malloc" /C:"^ *%1\.o(.*) refers.* to .* for calloc" /C:"^ *%1\.o(.*) refers.* to .* for realloc" /C:"^ *%1\.o(.*) refers.* to .* for free" %MAP%
+if not errorlevel 1 set FOUND=1
+exit /b 0